@@ -120,8 +120,14 @@ TEST_DLL_API double make_decision(
     }
 
     // Calculate the indicators and add them to the inputs
-    for (const auto &[timeframe, indicators] : config.training.inputs.indicators)
+    for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
     {
+        TimeFrame timeframe = static_cast<TimeFrame>(i);
+        const std::vector<Indicator *> &indicators = config.training.inputs.indicators[timeframe];
+        if (indicators.empty())
+        {
+            continue;
+        }
         if (std::find(candles_timeframes.begin(), candles_timeframes.end(), timeframe) == candles_timeframes.end())
         {
 #if defined(_WIN32)
@@ -20,6 +20,22 @@ void add_optional(nlohmann::json &json, const std::string &key, const std::optio
     }
 }
 
+void add_optional(nlohmann::json &json, const std::string &key, int value)
+{
+    if (is_set(value))
+    {
+        json[key] = value;
+    }
+}
+
+void add_optional(nlohmann::json &json, const std::string &key, double value)
+{
+    if (is_set(value))
+    {
+        json[key] = value;
+    }
+}
+
 void check_key(const nlohmann::json &json, const std::string &key)
 {
     if (!json.contains(key))
@@ -91,13 +107,13 @@ nlohmann::json config_to_json(const Config &config)
         {
             const auto &schedule = config.strategy.trading_schedule.value();
             nlohmann::json schedule_json = {
-                {"monday", schedule.monday},
-                {"tuesday", schedule.tuesday},
-                {"wednesday", schedule.wednesday},
-                {"thursday", schedule.thursday},
-                {"friday", schedule.friday},
-                {"saturday", schedule.saturday},
-                {"sunday", schedule.sunday},
+                {"monday", schedule.monday.to_hours()},
+                {"tuesday", schedule.tuesday.to_hours()},
+                {"wednesday", schedule.wednesday.to_hours()},
+                {"thursday", schedule.thursday.to_hours()},
+                {"friday", schedule.friday.to_hours()},
+                {"saturday", schedule.saturday.to_hours()},
+                {"sunday", schedule.sunday.to_hours()},
             };
             strategy_json["trading_schedule"] = schedule_json;
 
@@ -139,8 +155,14 @@ nlohmann::json config_to_json(const Config &config)
 
         // Training indicator inputs
         nlohmann::json indicators_json = nlohmann::json::object();
-        for (const auto &[timeframe, indicators] : config.training.inputs.indicators)
+        for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
         {
+            TimeFrame timeframe = static_cast<TimeFrame>(i);
+            const std::vector<Indicator *> &indicators = config.training.inputs.indicators[timeframe];
+            if (indicators.empty())
+            {
+                continue;
+            }
             nlohmann::json timeframe_json = nlohmann::json::array();
             for (const auto &indicator : indicators)
             {
@@ -426,23 +448,14 @@ Config config_from_json(const nlohmann::json &json)
 
         const auto &schedule_json = json["strategy"]["trading_schedule"];
         config.strategy.trading_schedule = TradingSchedule{
-            .monday = schedule_json["monday"],
-            .tuesday = schedule_json["tuesday"],
-            .wednesday = schedule_json["wednesday"],
-            .thursday = schedule_json["thursday"],
-            .friday = schedule_json["friday"],
-            .saturday = schedule_json["saturday"],
-            .sunday = schedule_json["sunday"],
+            .monday = schedule_json["monday"].get<std::vector<bool>>(),
+            .tuesday = schedule_json["tuesday"].get<std::vector<bool>>(),
+            .wednesday = schedule_json["wednesday"].get<std::vector<bool>>(),
+            .thursday = schedule_json["thursday"].get<std::vector<bool>>(),
+            .friday = schedule_json["friday"].get<std::vector<bool>>(),
+            .saturday = schedule_json["saturday"].get<std::vector<bool>>(),
+            .sunday = schedule_json["sunday"].get<std::vector<bool>>(),
         };
-
-        if (config.strategy.trading_schedule.has_value())
-        {
-            const auto &schedule = config.strategy.trading_schedule.value();
-            if (schedule.monday.size() != 24 || schedule.tuesday.size() != 24 || schedule.wednesday.size() != 24 || schedule.thursday.size() != 24 || schedule.friday.size() != 24 || schedule.saturday.size() != 24 || schedule.sunday.size() != 24)
-            {
-                throw std::runtime_error("Invalid trading schedule format: the array must contain 24 elements");
-            }
-        }
     }
 
     // Parse trailing stop loss config data
@@ -493,7 +506,7 @@ Config config_from_json(const nlohmann::json &json)
     const auto &indicators_json = inputs_json["indicators"];
     const auto &position_json = inputs_json["position"];
 
-    std::map<TimeFrame, std::vector<Indicator *>> indicators;
+    TimeFrameMap<std::vector<Indicator *>> indicators;
     for (const auto &[timeframe, indicators_id] : indicators_json.items())
     {
         std::vector<Indicator *> indicators_list;
@@ -645,26 +658,26 @@ bool is_same_config(const Config &config1, const Config &config2)
 
     bool is_same_strategy_config = config1.strategy.timeframe == config2.strategy.timeframe &&
                                    config1.strategy.risk_per_trade == config2.strategy.risk_per_trade &&
-                                   config1.strategy.maximum_trades_per_day.value_or(0) == config2.strategy.maximum_trades_per_day.value_or(0) &&
-                                   config1.strategy.maximum_spread.value_or(0) == config2.strategy.maximum_spread.value_or(0) &&
-                                   config1.strategy.minimum_trade_duration.value_or(0) == config2.strategy.minimum_trade_duration.value_or(0) &&
-                                   config1.strategy.maximum_trade_duration.value_or(0) == config2.strategy.maximum_trade_duration.value_or(0) &&
-                                   config1.strategy.minimum_duration_before_next_trade.value_or(0) == config2.strategy.minimum_duration_before_next_trade.value_or(0) &&
+                                   value_or(config1.strategy.maximum_trades_per_day, 0) == value_or(config2.strategy.maximum_trades_per_day, 0) &&
+                                   value_or(config1.strategy.maximum_spread, 0.0) == value_or(config2.strategy.maximum_spread, 0.0) &&
+                                   value_or(config1.strategy.minimum_trade_duration, 0) == value_or(config2.strategy.minimum_trade_duration, 0) &&
+                                   value_or(config1.strategy.maximum_trade_duration, 0) == value_or(config2.strategy.maximum_trade_duration, 0) &&
+                                   value_or(config1.strategy.minimum_duration_before_next_trade, 0) == value_or(config2.strategy.minimum_duration_before_next_trade, 0) &&
                                    config1.strategy.can_close_trade.value_or(true) == config2.strategy.can_close_trade.value_or(true) &&
                                    config1.strategy.can_open_long_trade.value_or(true) == config2.strategy.can_open_long_trade.value_or(true) &&
                                    config1.strategy.can_open_short_trade.value_or(true) == config2.strategy.can_open_short_trade.value_or(true) &&
                                    config1.strategy.take_profit_stop_loss_config.type_stop_loss == config2.strategy.take_profit_stop_loss_config.type_stop_loss &&
                                    config1.strategy.take_profit_stop_loss_config.type_take_profit == config2.strategy.take_profit_stop_loss_config.type_take_profit &&
-                                   config1.strategy.take_profit_stop_loss_config.stop_loss_in_points.value_or(0) == config2.strategy.take_profit_stop_loss_config.stop_loss_in_points.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.stop_loss_in_percent.value_or(0) == config2.strategy.take_profit_stop_loss_config.stop_loss_in_percent.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.stop_loss_extremum_period.value_or(0) == config2.strategy.take_profit_stop_loss_config.stop_loss_extremum_period.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.stop_loss_atr_period.value_or(0) == config2.strategy.take_profit_stop_loss_config.stop_loss_atr_period.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.stop_loss_atr_multiplier.value_or(0) == config2.strategy.take_profit_stop_loss_config.stop_loss_atr_multiplier.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.take_profit_in_points.value_or(0) == config2.strategy.take_profit_stop_loss_config.take_profit_in_points.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.take_profit_in_percent.value_or(0) == config2.strategy.take_profit_stop_loss_config.take_profit_in_percent.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.take_profit_extremum_period.value_or(0) == config2.strategy.take_profit_stop_loss_config.take_profit_extremum_period.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.take_profit_atr_period.value_or(0) == config2.strategy.take_profit_stop_loss_config.take_profit_atr_period.value_or(0) &&
-                                   config1.strategy.take_profit_stop_loss_config.take_profit_atr_multiplier.value_or(0) == config2.strategy.take_profit_stop_loss_config.take_profit_atr_multiplier.value_or(0);
+                                   value_or(config1.strategy.take_profit_stop_loss_config.stop_loss_in_points, 0) == value_or(config2.strategy.take_profit_stop_loss_config.stop_loss_in_points, 0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.stop_loss_in_percent, 0.0) == value_or(config2.strategy.take_profit_stop_loss_config.stop_loss_in_percent, 0.0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.stop_loss_extremum_period, 0) == value_or(config2.strategy.take_profit_stop_loss_config.stop_loss_extremum_period, 0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.stop_loss_atr_period, 0) == value_or(config2.strategy.take_profit_stop_loss_config.stop_loss_atr_period, 0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.stop_loss_atr_multiplier, 0.0) == value_or(config2.strategy.take_profit_stop_loss_config.stop_loss_atr_multiplier, 0.0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.take_profit_in_points, 0) == value_or(config2.strategy.take_profit_stop_loss_config.take_profit_in_points, 0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.take_profit_in_percent, 0.0) == value_or(config2.strategy.take_profit_stop_loss_config.take_profit_in_percent, 0.0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.take_profit_extremum_period, 0) == value_or(config2.strategy.take_profit_stop_loss_config.take_profit_extremum_period, 0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.take_profit_atr_period, 0) == value_or(config2.strategy.take_profit_stop_loss_config.take_profit_atr_period, 0) &&
+                                   value_or(config1.strategy.take_profit_stop_loss_config.take_profit_atr_multiplier, 0.0) == value_or(config2.strategy.take_profit_stop_loss_config.take_profit_atr_multiplier, 0.0);
 
     if (!is_same_strategy_config)
     {
@@ -698,10 +711,10 @@ bool is_same_config(const Config &config1, const Config &config2)
         const auto &tsl1 = config1.strategy.trailing_stop_loss_config.value();
         const auto &tsl2 = config2.strategy.trailing_stop_loss_config.value();
         is_same_trailing_stop_loss_config = tsl1.type == tsl2.type &&
-                                            tsl1.activation_level_in_points.value_or(0) == tsl2.activation_level_in_points.value_or(0) &&
-                                            tsl1.activation_level_in_percent.value_or(0) == tsl2.activation_level_in_percent.value_or(0) &&
-                                            tsl1.trailing_stop_loss_in_points.value_or(0) == tsl2.trailing_stop_loss_in_points.value_or(0) &&
-                                            tsl1.trailing_stop_loss_in_percent.value_or(0) == tsl2.trailing_stop_loss_in_percent.value_or(0);
+                                            value_or(tsl1.activation_level_in_points, 0) == value_or(tsl2.activation_level_in_points, 0) &&
+                                            value_or(tsl1.activation_level_in_percent, 0.0) == value_or(tsl2.activation_level_in_percent, 0.0) &&
+                                            value_or(tsl1.trailing_stop_loss_in_points, 0) == value_or(tsl2.trailing_stop_loss_in_points, 0) &&
+                                            value_or(tsl1.trailing_stop_loss_in_percent, 0.0) == value_or(tsl2.trailing_stop_loss_in_percent, 0.0);
     }
 
     if (!is_same_trailing_stop_loss_config)
@@ -715,13 +728,12 @@ bool is_same_config(const Config &config1, const Config &config2)
                                    config1.training.training_end_date == config2.training.training_end_date &&
                                    config1.training.test_start_date == config2.training.test_start_date &&
                                    config1.training.test_end_date == config2.training.test_end_date &&
-                                   config1.training.bad_trader_threshold.value_or(0) == config2.training.bad_trader_threshold.value_or(0) &&
-                                   config1.training.inactive_trader_threshold.value_or(0) == config2.training.inactive_trader_threshold.value_or(0) &&
-                                   config1.training.decision_threshold.value_or(0) == config2.training.decision_threshold.value_or(0) &&
-                                   config1.training.inputs.indicators.size() == config2.training.inputs.indicators.size() &&
+                                   value_or(config1.training.bad_trader_threshold, 0.0) == value_or(config2.training.bad_trader_threshold, 0.0) &&
+                                   value_or(config1.training.inactive_trader_threshold, 0.0) == value_or(config2.training.inactive_trader_threshold, 0.0) &&
+                                   value_or(config1.training.decision_threshold, 0.0) == value_or(config2.training.decision_threshold, 0.0) &&
                                    config1.training.inputs.position.size() == config2.training.inputs.position.size() &&
                                    std::equal(config1.training.inputs.position.begin(), config1.training.inputs.position.end(), config2.training.inputs.position.begin()) &&
-                                   std::equal(config1.training.inputs.indicators.begin(), config1.training.inputs.indicators.end(), config2.training.inputs.indicators.begin());
+                                   config1.training.inputs.indicators == config2.training.inputs.indicators;
 
     if (!is_same_training_config)
     {
@@ -730,14 +742,14 @@ bool is_same_config(const Config &config1, const Config &config2)
     }
 
     bool is_same_evaluation_config = config1.evaluation.maximize_nb_trades.value_or(0) == config2.evaluation.maximize_nb_trades.value_or(0) &&
-                                     config1.evaluation.minimum_nb_trades.value_or(0) == config2.evaluation.minimum_nb_trades.value_or(0) &&
-                                     config1.evaluation.maximum_trade_duration.value_or(0) == config2.evaluation.maximum_trade_duration.value_or(0) &&
-                                     config1.evaluation.expected_return_per_day.value_or(0) == config2.evaluation.expected_return_per_day.value_or(0) &&
-                                     config1.evaluation.expected_return_per_month.value_or(0) == config2.evaluation.expected_return_per_month.value_or(0) &&
-                                     config1.evaluation.expected_return.value_or(0) == config2.evaluation.expected_return.value_or(0) &&
-                                     config1.evaluation.maximum_drawdown.value_or(0) == config2.evaluation.maximum_drawdown.value_or(0) &&
-                                     config1.evaluation.minimum_winrate.value_or(0) == config2.evaluation.minimum_winrate.value_or(0) &&
-                                     config1.evaluation.minimum_profit_factor.value_or(0) == config2.evaluation.minimum_profit_factor.value_or(0);
+                                     value_or(config1.evaluation.minimum_nb_trades, 0) == value_or(config2.evaluation.minimum_nb_trades, 0) &&
+                                     value_or(config1.evaluation.maximum_trade_duration, 0) == value_or(config2.evaluation.maximum_trade_duration, 0) &&
+                                     value_or(config1.evaluation.expected_return_per_day, 0.0) == value_or(config2.evaluation.expected_return_per_day, 0.0) &&
+                                     value_or(config1.evaluation.expected_return_per_month, 0.0) == value_or(config2.evaluation.expected_return_per_month, 0.0) &&
+                                     value_or(config1.evaluation.expected_return, 0.0) == value_or(config2.evaluation.expected_return, 0.0) &&
+                                     value_or(config1.evaluation.maximum_drawdown, 0.0) == value_or(config2.evaluation.maximum_drawdown, 0.0) &&
+                                     value_or(config1.evaluation.minimum_winrate, 0.0) == value_or(config2.evaluation.minimum_winrate, 0.0) &&
+                                     value_or(config1.evaluation.minimum_profit_factor, 0.0) == value_or(config2.evaluation.minimum_profit_factor, 0.0);
 
     if (!is_same_evaluation_config)
     {
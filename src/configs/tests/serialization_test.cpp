@@ -48,9 +48,9 @@ public:
                 .name = "test",
                 .version = "1.0",
                 .symbol = "EURUSD",
-                .leverage = 100,
                 .initial_balance = 1000,
                 .account_currency = "USD",
+                .leverage = 100,
             },
             .strategy = {
                 .timeframe = TimeFrame::M15,
@@ -101,11 +101,11 @@ public:
             },
             .evaluation = {
                 .maximum_trade_duration = 5,
-                .maximum_drawdown = 0.1,
                 .expected_return_per_day = 0.01,
                 .expected_return_per_month = 0.1,
-                .minimum_profit_factor = 2,
+                .maximum_drawdown = 0.1,
                 .minimum_winrate = 0.5,
+                .minimum_profit_factor = 2,
             },
             .neat = neat::load_config("src/configs/neat_config.txt"),
         };
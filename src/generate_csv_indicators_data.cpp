@@ -58,10 +58,14 @@ int main(int argc, char *argv[])
     // Create the config object
     Config config = config_from_json(config_json_data);
 
-    for (const auto &indicator : config.training.inputs.indicators)
+    for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
     {
-        TimeFrame timeframe = indicator.first;
-        std::vector<Indicator *> indicators = indicator.second;
+        TimeFrame timeframe = static_cast<TimeFrame>(i);
+        std::vector<Indicator *> indicators = config.training.inputs.indicators[timeframe];
+        if (indicators.empty())
+        {
+            continue;
+        }
         std::string symbol = config.general.symbol;
 
         // Data to be written to the csv file
@@ -26,25 +26,33 @@
 
 /**
  * @brief Get the indicators map.
- * @return std::map<std::string, std::function<Indicator *(std::vector<IndicatorParam>)>> The indicators map.
+ *
+ * The merged map is built once on first use and cached, so repeated factory
+ * calls neither re-insert the per-module registrations nor copy the map.
+ *
+ * @return const std::unordered_map<std::string, IndicatorFactory> & The indicators map.
  */
-std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> get_indicators_map()
+const std::unordered_map<std::string, IndicatorFactory> &get_indicators_map()
 {
     // Map linking the indicator ID to the constructor function
-    std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> indicators_map = {};
-
-    indicators_map.insert(candle_patterns_indicators_map.begin(), candle_patterns_indicators_map.end());
-    indicators_map.insert(candle_signals_indicators_map.begin(), candle_signals_indicators_map.end());
-    indicators_map.insert(candle_indicators_map.begin(), candle_indicators_map.end());
-    indicators_map.insert(momentum_signals_indicators_map.begin(), momentum_signals_indicators_map.end());
-    indicators_map.insert(momentum_indicators_map.begin(), momentum_indicators_map.end());
-    indicators_map.insert(time_indicators_map.begin(), time_indicators_map.end());
-    indicators_map.insert(trend_signals_indicators_map.begin(), trend_signals_indicators_map.end());
-    indicators_map.insert(trend_indicators_map.begin(), trend_indicators_map.end());
-    indicators_map.insert(volatility_signals_indicators_map.begin(), volatility_signals_indicators_map.end());
-    indicators_map.insert(volatility_indicators_map.begin(), volatility_indicators_map.end());
-    indicators_map.insert(volume_signals_indicators_map.begin(), volume_signals_indicators_map.end());
-    indicators_map.insert(volume_indicators_map.begin(), volume_indicators_map.end());
+    static const std::unordered_map<std::string, IndicatorFactory> indicators_map = []
+    {
+        std::unordered_map<std::string, IndicatorFactory> merged_map = {};
+
+        merged_map.insert(candle_patterns_indicators_map.begin(), candle_patterns_indicators_map.end());
+        merged_map.insert(candle_signals_indicators_map.begin(), candle_signals_indicators_map.end());
+        merged_map.insert(candle_indicators_map.begin(), candle_indicators_map.end());
+        merged_map.insert(momentum_signals_indicators_map.begin(), momentum_signals_indicators_map.end());
+        merged_map.insert(time_indicators_map.begin(), time_indicators_map.end());
+        merged_map.insert(trend_signals_indicators_map.begin(), trend_signals_indicators_map.end());
+        merged_map.insert(trend_indicators_map.begin(), trend_indicators_map.end());
+        merged_map.insert(volatility_signals_indicators_map.begin(), volatility_signals_indicators_map.end());
+        merged_map.insert(volatility_indicators_map.begin(), volatility_indicators_map.end());
+        merged_map.insert(volume_signals_indicators_map.begin(), volume_signals_indicators_map.end());
+        merged_map.insert(volume_indicators_map.begin(), volume_indicators_map.end());
+
+        return merged_map;
+    }();
 
     return indicators_map;
 }
@@ -102,28 +110,29 @@ std::unordered_map<std::string, IndicatorParam> extract_parameters(const std::st
  *
  * @return true If the parameters are valid with the ID pattern.
  */
-bool check_params(const std::unordered_map<std::string, IndicatorParam> &params, const std::unordered_map<std::string, std::type_index> &required_params)
+bool check_params(const std::unordered_map<std::string, IndicatorParam> &params, std::initializer_list<std::pair<const char *, std::type_index>> required_params)
 {
     for (const auto &[param_name, param_type] : required_params)
     {
-        if (params.find(param_name) == params.end())
+        auto it = params.find(param_name);
+        if (it == params.end())
         {
-            throw std::invalid_argument("Missing parameter " + param_name);
+            throw std::invalid_argument("Missing parameter " + std::string(param_name));
         }
 
-        if (param_type == typeid(int) && !std::holds_alternative<int>(params.at(param_name)))
+        if (param_type == typeid(int) && !std::holds_alternative<int>(it->second))
         {
-            throw std::invalid_argument("Invalid type for parameter " + param_name);
+            throw std::invalid_argument("Invalid type for parameter " + std::string(param_name));
         }
 
-        if (param_type == typeid(double) && !std::holds_alternative<double>(params.at(param_name)))
+        if (param_type == typeid(double) && !std::holds_alternative<double>(it->second))
         {
-            throw std::invalid_argument("Invalid type for parameter " + param_name);
+            throw std::invalid_argument("Invalid type for parameter " + std::string(param_name));
         }
 
-        if (param_type == typeid(std::string) && !std::holds_alternative<std::string>(params.at(param_name)))
+        if (param_type == typeid(std::string) && !std::holds_alternative<std::string>(it->second))
         {
-            throw std::invalid_argument("Invalid type for parameter " + param_name);
+            throw std::invalid_argument("Invalid type for parameter " + std::string(param_name));
         }
     }
 
@@ -141,25 +150,21 @@ Indicator *create_indicator_from_id(const std::string &id, const std::unordered_
 {
     try
     {
+        // The momentum indicators dispatch on the ID directly, without going through the map
+        if (Indicator *indicator = create_momentum_indicator(id, params))
+        {
+            return indicator;
+        }
+
         // Get the indicators map
-        std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> indicators_map = get_indicators_map();
+        const std::unordered_map<std::string, IndicatorFactory> &indicators_map = get_indicators_map();
 
-        for (const auto &[indicator_id, indicator_constructor] : indicators_map)
+        // Look the indicator ID up directly instead of scanning every entry
+        auto it = indicators_map.find(id);
+        if (it != indicators_map.end())
         {
-            if (id == indicator_id)
-            {
-                // Check if the indicator ID exists in the map
-                auto it = indicators_map.find(indicator_id);
-                if (it != indicators_map.end())
-                {
-                    // Call the constructor function to create an instance of the indicator
-                    return indicator_constructor(params);
-                }
-                else
-                {
-                    throw std::invalid_argument("No constructor found for indicator ID: " + indicator_id);
-                }
-            }
+            // Call the constructor function to create an instance of the indicator
+            return it->second(params);
         }
 
         throw std::invalid_argument("No indicator found for ID: " + id);
@@ -7,11 +7,24 @@
 #include <typeindex>
 #include "indicator.hpp"
 
+/**
+ * @brief Factory function creating an indicator from its parameters.
+ *
+ * The registered factories capture nothing, so the maps store plain function
+ * pointers instead of type-erased std::function wrappers; this keeps each
+ * registration allocation-free and the dispatch a direct indirect call.
+ */
+using IndicatorFactory = Indicator *(*)(std::unordered_map<std::string, IndicatorParam>);
+
 /**
  * @brief Get the indicators map.
- * @return std::map<std::string, std::function<Indicator *(std::vector<IndicatorParam>)>> The indicators map.
+ *
+ * The merged map is built once on first use and cached, so repeated factory
+ * calls neither re-insert the per-module registrations nor copy the map.
+ *
+ * @return const std::unordered_map<std::string, IndicatorFactory> & The indicators map.
  */
-std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> get_indicators_map();
+const std::unordered_map<std::string, IndicatorFactory> &get_indicators_map();
 
 /**
  * @brief Extract the parameters from the ID.
@@ -24,19 +37,25 @@ std::unordered_map<std::string, IndicatorParam> extract_parameters(const std::st
 /**
  * @brief Check if the parameters are valid with the ID pattern.
  *
+ * The schema is a plain initializer list of name/type pairs with string
+ * literal keys, so validating does not build a temporary map or allocate
+ * key strings on every factory call.
+ *
  * @param params The parameters.
  * @param required_params The required parameters with their types.
  *
  * @return true If the parameters are valid with the ID pattern.
  */
-bool check_params(const std::unordered_map<std::string, IndicatorParam> &params, const std::unordered_map<std::string, std::type_index> &required_params);
+bool check_params(const std::unordered_map<std::string, IndicatorParam> &params, std::initializer_list<std::pair<const char *, std::type_index>> required_params);
 
 /**
  * @brief Build an indicator from the ID.
  *
+ * The caller owns the returned indicator.
+ *
  * @param id The ID of the indicator.
  * @param params The parameters of the indicator.
- * @return Indicator The indicator.
+ * @return Indicator* The indicator, or nullptr if it could not be created.
  */
 Indicator *create_indicator_from_id(const std::string &id, const std::unordered_map<std::string, IndicatorParam> params);
 
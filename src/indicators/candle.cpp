@@ -28,7 +28,7 @@ CandleOpen::CandleOpen(int offset) : Indicator("Candle Open", "candle-open", {{"
 std::vector<double> CandleOpen::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -58,7 +58,7 @@ CandleHigh::CandleHigh(int offset) : Indicator("Candle High", "candle-high", {{"
 std::vector<double> CandleHigh::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -89,7 +89,7 @@ CandleLow::CandleLow(int offset) : Indicator("Candle Low", "candle-low", {{"offs
 std::vector<double> CandleLow::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -120,7 +120,7 @@ CandleClose::CandleClose(int offset) : Indicator("Candle Close", "candle-close",
 std::vector<double> CandleClose::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         { 
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -151,7 +151,7 @@ CandleTickVolume::CandleTickVolume(int offset) : Indicator("Candle Tick Volume",
 std::vector<double> CandleTickVolume::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -182,7 +182,7 @@ CandleVolume::CandleVolume(int offset) : Indicator("Candle Volume", "candle-volu
 std::vector<double> CandleVolume::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -213,7 +213,7 @@ WhiteCandle::WhiteCandle(int offset) : Indicator("White Candle", "white-candle",
 std::vector<double> WhiteCandle::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -244,7 +244,7 @@ BlackCandle::BlackCandle(int offset) : Indicator("Black Candle", "black-candle",
 std::vector<double> BlackCandle::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -275,7 +275,7 @@ CandleBody::CandleBody(int offset) : Indicator("Candle Body", "candle-body", {{"
 std::vector<double> CandleBody::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             // Initialize values vector with size of candles
             std::vector<double> values(candles.size(), 0);
@@ -312,7 +312,7 @@ CandleShadowUpper::CandleShadowUpper(int offset) : Indicator("Candle Shadow Uppe
 std::vector<double> CandleShadowUpper::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -347,7 +347,7 @@ CandleShadowLower::CandleShadowLower(int offset) : Indicator("Candle Shadow Lowe
 std::vector<double> CandleShadowLower::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (int i = 0; i < candles.size(); ++i)
@@ -382,7 +382,7 @@ CandlePriceChange::CandlePriceChange(int offset) : Indicator("Candle Price Chang
 std::vector<double> CandlePriceChange::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values;
             for (size_t i = 0; i < candles.size(); ++i)
@@ -404,7 +404,7 @@ std::vector<double> CandlePriceChange::calculate(const std::vector<Candle> &cand
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-PivotHigh::PivotHigh(std::string source, int left_bars, int right_bars, int offset) : Indicator("Pivot High", "pivot-high", {{"source", source}, {"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}) {}
+PivotHigh::PivotHigh(std::string source, int left_bars, int right_bars, int offset) : Indicator("Pivot High", "pivot-high", {{"source", source}, {"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}), source(parse_candle_source(source)), left_bars(left_bars), right_bars(right_bars) {}
 
 /**
  * @brief Calculate the PivotHigh values.
@@ -416,12 +416,8 @@ PivotHigh::PivotHigh(std::string source, int left_bars, int right_bars, int offs
 std::vector<double> PivotHigh::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-            std::string source = std::get<std::string>(this->params.at("source"));
-
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
             std::vector<double> source_candles = get_candles_with_source(candles, source);
 
@@ -448,7 +444,7 @@ std::vector<double> PivotHigh::calculate(const std::vector<Candle> &candles, boo
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-PivotLow::PivotLow(std::string source, int left_bars, int right_bars, int offset) : Indicator("Pivot Low", "pivot-low", {{"source", source}, {"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}) {}
+PivotLow::PivotLow(std::string source, int left_bars, int right_bars, int offset) : Indicator("Pivot Low", "pivot-low", {{"source", source}, {"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}), source(parse_candle_source(source)), left_bars(left_bars), right_bars(right_bars) {}
 
 /**
  * @brief Calculate the PivotLow values.
@@ -460,12 +456,8 @@ PivotLow::PivotLow(std::string source, int left_bars, int right_bars, int offset
 std::vector<double> PivotLow::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-            std::string source = std::get<std::string>(this->params.at("source"));
-
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
             std::vector<double> source_candles = get_candles_with_source(candles, source);
 
@@ -493,7 +485,7 @@ std::vector<double> PivotLow::calculate(const std::vector<Candle> &candles, bool
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-PivotHighValue::PivotHighValue(std::string source, int left_bars, int right_bars, int offset) : Indicator("Pivot High Value", "pivot-high-value", {{"source", source}, {"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}) {}
+PivotHighValue::PivotHighValue(std::string source, int left_bars, int right_bars, int offset) : Indicator("Pivot High Value", "pivot-high-value", {{"source", source}, {"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}), source(parse_candle_source(source)), left_bars(left_bars), right_bars(right_bars), offset(offset) {}
 
 /**
  * @brief Calculate the PivotHighValue values.
@@ -505,13 +497,8 @@ PivotHighValue::PivotHighValue(std::string source, int left_bars, int right_bars
 std::vector<double> PivotHighValue::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-            std::string source = std::get<std::string>(this->params.at("source"));
-            int offset = std::get<int>(this->params.at("offset"));
-
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
             std::vector<double> pivots = PivotHigh("high", left_bars, right_bars, offset).calculate(candles, false);
             std::vector<double> source_candles = get_candles_with_source(candles, source);
@@ -551,7 +538,7 @@ std::vector<double> PivotHighValue::calculate(const std::vector<Candle> &candles
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-PivotLowValue::PivotLowValue(std::string source, int left_bars, int right_bars, int offset) : Indicator("Pivot Low Value", "pivot-low-value", {{"source", source}, {"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}) {}
+PivotLowValue::PivotLowValue(std::string source, int left_bars, int right_bars, int offset) : Indicator("Pivot Low Value", "pivot-low-value", {{"source", source}, {"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}), source(parse_candle_source(source)), left_bars(left_bars), right_bars(right_bars), offset(offset) {}
 
 /**
  * @brief Calculate the PivotLowValue values.
@@ -563,13 +550,8 @@ PivotLowValue::PivotLowValue(std::string source, int left_bars, int right_bars,
 std::vector<double> PivotLowValue::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-            std::string source = std::get<std::string>(this->params.at("source"));
-            int offset = std::get<int>(this->params.at("offset"));
-
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
             std::vector<double> pivots = PivotLow("low", left_bars, right_bars, offset).calculate(candles, false);
             std::vector<double> source_candles = get_candles_with_source(candles, source);
@@ -608,7 +590,7 @@ std::vector<double> PivotLowValue::calculate(const std::vector<Candle> &candles,
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-HighestHigh::HighestHigh(int left_bars, int right_bars, int offset) : Indicator("Highest High", "highest-high", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}) {}
+HighestHigh::HighestHigh(int left_bars, int right_bars, int offset) : Indicator("Highest High", "highest-high", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}), left_bars(left_bars), right_bars(right_bars) {}
 
 /**
  * @brief Calculate the HighestHigh values.
@@ -620,13 +602,10 @@ HighestHigh::HighestHigh(int left_bars, int right_bars, int offset) : Indicator(
 std::vector<double> HighestHigh::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
-            std::vector<double> highs_values = get_candles_with_source(candles, "high");
+            std::vector<double> highs_values = get_candles_with_source(candles, CandleSource::HIGH);
 
             for (size_t i = 0; i < candles.size(); ++i)
             {
@@ -661,7 +640,7 @@ std::vector<double> HighestHigh::calculate(const std::vector<Candle> &candles, b
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-LowestLow::LowestLow(int left_bars, int right_bars, int offset) : Indicator("Lowest Low", "lowest-low", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}) {}
+LowestLow::LowestLow(int left_bars, int right_bars, int offset) : Indicator("Lowest Low", "lowest-low", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}), left_bars(left_bars), right_bars(right_bars) {}
 
 /**
  * @brief Calculate the LowestLow values.
@@ -673,13 +652,10 @@ LowestLow::LowestLow(int left_bars, int right_bars, int offset) : Indicator("Low
 std::vector<double> LowestLow::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
-            std::vector<double> lows_values = get_candles_with_source(candles, "low");
+            std::vector<double> lows_values = get_candles_with_source(candles, CandleSource::LOW);
 
             for (size_t i = 0; i < candles.size(); ++i)
             {
@@ -714,7 +690,7 @@ std::vector<double> LowestLow::calculate(const std::vector<Candle> &candles, boo
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-PeakDistance::PeakDistance(int left_bars, int right_bars, int offset) : Indicator("Peak Distance", "peak-distance", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}) {}
+PeakDistance::PeakDistance(int left_bars, int right_bars, int offset) : Indicator("Peak Distance", "peak-distance", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}), left_bars(left_bars), right_bars(right_bars), offset(offset) {}
 
 /**
  * @brief Calculate the PeakDistance values.
@@ -726,12 +702,8 @@ PeakDistance::PeakDistance(int left_bars, int right_bars, int offset) : Indicato
 std::vector<double> PeakDistance::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-            int offset = std::get<int>(this->params.at("offset"));
-
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
             std::vector<double> highest_highs = HighestHigh(left_bars, right_bars, offset).calculate(candles, false);
             std::vector<double> lowest_lows = LowestLow(left_bars, right_bars, offset).calculate(candles, false);
@@ -756,7 +728,7 @@ std::vector<double> PeakDistance::calculate(const std::vector<Candle> &candles,
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-PeakCandleDistance::PeakCandleDistance(int left_bars, int right_bars, int offset) : Indicator("Peak Candle Distance", "peak-candle-distance", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}) {}
+PeakCandleDistance::PeakCandleDistance(int left_bars, int right_bars, int offset) : Indicator("Peak Candle Distance", "peak-candle-distance", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}), left_bars(left_bars), right_bars(right_bars), offset(offset) {}
 
 /**
  * @brief Calculate the PeakCandleDistance values.
@@ -768,12 +740,8 @@ PeakCandleDistance::PeakCandleDistance(int left_bars, int right_bars, int offset
 std::vector<double> PeakCandleDistance::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-            int offset = std::get<int>(this->params.at("offset"));
-
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
             std::vector<double> pivots_high_values = PivotHigh("high", left_bars, right_bars, offset).calculate(candles, false);
             std::vector<double> pivots_low_values = PivotLow("low", left_bars, right_bars, offset).calculate(candles, false);
@@ -326,6 +326,11 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    CandleSource source; // Source of candle data, decoded at construction
+    int left_bars;      // Number of left bars, decoded at construction
+    int right_bars;     // Number of right bars, decoded at construction
 };
 
 /**
@@ -352,6 +357,11 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    CandleSource source; // Source of candle data, decoded at construction
+    int left_bars;      // Number of left bars, decoded at construction
+    int right_bars;     // Number of right bars, decoded at construction
 };
 
 /**
@@ -378,6 +388,12 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    CandleSource source; // Source of candle data, decoded at construction
+    int left_bars;      // Number of left bars, decoded at construction
+    int right_bars;     // Number of right bars, decoded at construction
+    int offset;         // Offset value, decoded at construction
 };
 
 /**
@@ -404,6 +420,12 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    CandleSource source; // Source of candle data, decoded at construction
+    int left_bars;      // Number of left bars, decoded at construction
+    int right_bars;     // Number of right bars, decoded at construction
+    int offset;         // Offset value, decoded at construction
 };
 
 /**
@@ -429,6 +451,10 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    int left_bars;  // Number of left bars, decoded at construction
+    int right_bars; // Number of right bars, decoded at construction
 };
 
 /**
@@ -454,6 +480,10 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    int left_bars;  // Number of left bars, decoded at construction
+    int right_bars; // Number of right bars, decoded at construction
 };
 
 /**
@@ -481,6 +511,11 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    int left_bars;  // Number of left bars, decoded at construction
+    int right_bars; // Number of right bars, decoded at construction
+    int offset;     // Offset value, decoded at construction
 };
 
 /**
@@ -508,9 +543,14 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    int left_bars;  // Number of left bars, decoded at construction
+    int right_bars; // Number of right bars, decoded at construction
+    int offset;     // Offset value, decoded at construction
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> candle_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> candle_indicators_map = {
     {"candle-open", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
@@ -25,7 +25,7 @@ std::vector<double>
 DojiCandlePattern::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
 
@@ -173,7 +173,7 @@ SingleCandlePattern::SingleCandlePattern(int offset) : Indicator("Single Candle
 std::vector<double> SingleCandlePattern::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
 
@@ -491,7 +491,7 @@ DoubleCandlePattern::DoubleCandlePattern(int offset) : Indicator("Double Candle
 std::vector<double> DoubleCandlePattern::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
 
@@ -691,7 +691,7 @@ TripleCandlePattern::TripleCandlePattern(int offset) : Indicator("Triple Candle
 std::vector<double> TripleCandlePattern::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> values(candles.size(), 0); // Initialize values vector with size of candles
 
@@ -362,7 +362,7 @@ private:
     bool isThreeStarsInTheNorth(const std::vector<Candle> &candles, size_t index) const;
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> candle_patterns_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> candle_patterns_indicators_map = {
     {"doji-candle-pattern", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
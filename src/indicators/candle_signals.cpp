@@ -11,7 +11,7 @@
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-NewHighSignal::NewHighSignal(int left_bars, int right_bars, int offset) : Indicator("New High (Signal)", "new-high-signal", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}) {}
+NewHighSignal::NewHighSignal(int left_bars, int right_bars, int offset) : Indicator("New High (Signal)", "new-high-signal", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}), left_bars(left_bars), right_bars(right_bars) {}
 
 /**
  * @brief Calculate the New High Signal values.
@@ -23,14 +23,11 @@ NewHighSignal::NewHighSignal(int left_bars, int right_bars, int offset) : Indica
 std::vector<double> NewHighSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-
             std::vector<double> values(candles.size(), 0);
             std::vector<double> highest_highs = PivotHighValue("high", left_bars, right_bars).calculate(candles, false);
-            std::vector<double> highs = get_candles_with_source(candles, "high");
+            std::vector<double> highs = get_candles_with_source(candles, CandleSource::HIGH);
 
             for (size_t i = std::max(left_bars + right_bars, 1); i < candles.size() - right_bars; ++i)
             {
@@ -55,7 +52,7 @@ std::vector<double> NewHighSignal::calculate(const std::vector<Candle> &candles,
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-NewLowSignal::NewLowSignal(int left_bars, int right_bars, int offset) : Indicator("New Low (Signal)", "new-low-signal", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}) {}
+NewLowSignal::NewLowSignal(int left_bars, int right_bars, int offset) : Indicator("New Low (Signal)", "new-low-signal", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}), left_bars(left_bars), right_bars(right_bars) {}
 
 /**
  * @brief Calculate the New Low Signal values.
@@ -67,14 +64,11 @@ NewLowSignal::NewLowSignal(int left_bars, int right_bars, int offset) : Indicato
 std::vector<double> NewLowSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-
             std::vector<double> values(candles.size(), 0);
             std::vector<double> lowest_lows = PivotLowValue("low", left_bars, right_bars).calculate(candles, false);
-            std::vector<double> lows = get_candles_with_source(candles, "low");
+            std::vector<double> lows = get_candles_with_source(candles, CandleSource::LOW);
 
             for (size_t i = std::max(left_bars + right_bars, 1); i < candles.size() - right_bars; ++i)
             {
@@ -99,7 +93,7 @@ std::vector<double> NewLowSignal::calculate(const std::vector<Candle> &candles,
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-HighBreakSignal::HighBreakSignal(int left_bars, int right_bars, int offset) : Indicator("High Break (Signal)", "high-break-signal", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}) {}
+HighBreakSignal::HighBreakSignal(int left_bars, int right_bars, int offset) : Indicator("High Break (Signal)", "high-break-signal", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}), left_bars(left_bars), right_bars(right_bars) {}
 
 /**
  * @brief Calculate the High Break Signal values.
@@ -111,14 +105,11 @@ HighBreakSignal::HighBreakSignal(int left_bars, int right_bars, int offset) : In
 std::vector<double> HighBreakSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-
             std::vector<double> values(candles.size(), 0);
             std::vector<double> highest_highs = PivotHighValue("high", left_bars, right_bars).calculate(candles, false);
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
 
             for (size_t i = 1; i < candles.size(); ++i)
             {
@@ -142,7 +133,7 @@ std::vector<double> HighBreakSignal::calculate(const std::vector<Candle> &candle
  * @param right_bars Number of right bars.
  * @param offset Offset value. Default is 0.
  */
-LowBreakSignal::LowBreakSignal(int left_bars, int right_bars, int offset) : Indicator("Low Break (Signal)", "low-break-signal", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}) {}
+LowBreakSignal::LowBreakSignal(int left_bars, int right_bars, int offset) : Indicator("Low Break (Signal)", "low-break-signal", {{"left_bars", left_bars}, {"right_bars", right_bars}, {"offset", offset}}, {0, 1}), left_bars(left_bars), right_bars(right_bars) {}
 
 /**
  * @brief Calculate the Low Break Signal values.
@@ -154,14 +145,11 @@ LowBreakSignal::LowBreakSignal(int left_bars, int right_bars, int offset) : Indi
 std::vector<double> LowBreakSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
-            int left_bars = std::get<int>(this->params.at("left_bars"));
-            int right_bars = std::get<int>(this->params.at("right_bars"));
-
             std::vector<double> values(candles.size(), 0);
             std::vector<double> lowest_lows = PivotLowValue("low", left_bars, right_bars).calculate(candles, false);
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
 
             for (size_t i = 1; i < candles.size(); ++i)
             {
@@ -31,6 +31,10 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    int left_bars;  // Number of left bars, decoded at construction
+    int right_bars; // Number of right bars, decoded at construction
 };
 
 // *********************************************************************************************
@@ -55,6 +59,10 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    int left_bars;  // Number of left bars, decoded at construction
+    int right_bars; // Number of right bars, decoded at construction
 };
 
 // *********************************************************************************************
@@ -79,6 +87,10 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    int left_bars;  // Number of left bars, decoded at construction
+    int right_bars; // Number of right bars, decoded at construction
 };
 
 // *********************************************************************************************
@@ -103,9 +115,13 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    int left_bars;  // Number of left bars, decoded at construction
+    int right_bars; // Number of right bars, decoded at construction
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> candle_signals_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> candle_signals_indicators_map = {
     {"new-high-signal", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
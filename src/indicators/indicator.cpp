@@ -1,5 +1,6 @@
 #include <iostream>
 #include <regex>
+#include <mutex>
 #include <cmath>
 #include <stdexcept>
 #include <utility>
@@ -7,12 +8,39 @@
 #include <functional>
 #include <unordered_map>
 #include "../utils/vectors.hpp"
+#include "../utils/candles_source.hpp"
 #include "../types.hpp"
 #include "indicator.hpp"
 
 #include "candle_patterns.hpp"
 #include "momentum.hpp"
 
+/**
+ * @brief Get the compiled regex for a pattern, compiling it on first use.
+ *
+ * The same few ID patterns are validated over and over, so the compiled
+ * regexes are cached instead of being rebuilt on every call. The cache is
+ * guarded by a mutex because indicators are validated from the parallel
+ * batch path.
+ *
+ * @param pattern The regex pattern.
+ * @return const std::regex & The compiled regex.
+ */
+static const std::regex &get_cached_regex(const std::string &pattern)
+{
+    static std::mutex cache_mutex;
+    static std::unordered_map<std::string, std::regex> cache;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = cache.find(pattern);
+    if (it == cache.end())
+    {
+        it = cache.emplace(pattern, std::regex(pattern)).first;
+    }
+
+    return it->second;
+}
+
 /**
  * @brief Check if the ID with parameters is valid.
  *
@@ -22,7 +50,7 @@
  */
 bool is_valid_id_with_params(const std::string &id_params, const std::string &id_params_pattern)
 {
-    std::regex pattern(id_params_pattern);
+    const std::regex &pattern = get_cached_regex(id_params_pattern);
     return std::regex_match(id_params, pattern);
 }
 
@@ -63,6 +91,27 @@ bool is_valid_params_with_id_params_pattern(const std::string &id, const std::ve
 
 // *********************************************************************************************************************
 
+/**
+ * @brief Get a scratch buffer by index, resized and zero-filled.
+ *
+ * @param index The index of the buffer.
+ * @param size The required size of the buffer.
+ * @return AlignedVector<double>& The buffer.
+ */
+AlignedVector<double> &IndicatorScratch::get_buffer(size_t index, size_t size)
+{
+    if (index >= MAX_BUFFERS)
+    {
+        throw std::out_of_range("IndicatorScratch::get_buffer: buffer index out of range");
+    }
+
+    // Reuse the existing allocation when the buffer is already large enough
+    this->buffers[index].assign(size, 0.0);
+    return this->buffers[index];
+}
+
+// *********************************************************************************************************************
+
 /**
  * @brief Construct a new Indicator::Indicator object.
  *
@@ -119,7 +168,7 @@ Indicator::Indicator(std::string label, std::string id, std::unordered_map<std::
  * @param normalize_data Normalize the data.
  * @return std::vector<double> The calculated indicator values.
  */
-std::vector<double> Indicator::calculate(const std::vector<Candle> &candles, std::function<std::vector<double>(std::vector<Candle>)> calculator, bool normalize_data) const
+std::vector<double> Indicator::calculate(const std::vector<Candle> &candles, const std::function<std::vector<double>(const std::vector<Candle> &)> &calculator, bool normalize_data) const
 {
     std::vector<double> values(candles.size(), 0.0);
     int offset = std::get<int>(this->params.at("offset"));
@@ -188,7 +237,139 @@ std::vector<double> Indicator::calculate(const std::vector<Candle> &candles, std
 std::vector<double> Indicator::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [](std::vector<Candle> candles)
+        candles, [](const std::vector<Candle> &candles)
         { return std::vector<double>(candles.size(), 0.0); },
         normalize_data);
 }
+
+/**
+ * @brief Calculate the indicator into a caller-provided buffer.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Normalize the data.
+ */
+void Indicator::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    output = this->calculate(candles, normalize_data);
+}
+
+/**
+ * @brief Calculate the indicator from the candle columns into a caller-provided buffer.
+ *
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param calculator The calculator function, invoked with the number of candles to process.
+ * @param normalize_data Normalize the data.
+ */
+void Indicator::calculate_into(const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, const std::function<void(const CandleSoA &, size_t, std::vector<double> &, IndicatorScratch &)> &calculator, bool normalize_data) const
+{
+    size_t size = source.size();
+    output.assign(size, 0.0);
+    int offset = std::get<int>(this->params.at("offset"));
+
+    if (offset < 0)
+    {
+        std::cerr << "Offset cannot be negative." << std::endl;
+        return;
+    }
+    else if (size == 0)
+    {
+        std::cerr << "Candles data is empty." << std::endl;
+        return;
+    }
+    else if (size < static_cast<size_t>(offset))
+    {
+        std::cerr << "Offset is greater than the number of candles." << std::endl;
+        return;
+    }
+    else if (size == static_cast<size_t>(offset))
+    {
+        std::cerr << "Offset is equal to the number of candles." << std::endl;
+        return;
+    }
+
+    // Calculate the indicator over the candles minus the offset
+    calculator(source, size - offset, output, scratch);
+
+    // Shift the values by the offset and zero the leading entries
+    if (offset > 0)
+    {
+        for (size_t i = size; i-- > static_cast<size_t>(offset);)
+        {
+            output[i] = output[i - offset];
+        }
+        std::fill(output.begin(), output.begin() + offset, 0.0);
+    }
+
+    // Normalize the data
+    if (normalize_data)
+    {
+        output = normalize_vector(output, this->values_range);
+    }
+
+    // Check that there isn't nan values
+    if (std::any_of(output.begin(), output.end(), [](double value)
+                    { return std::isnan(value); }))
+    {
+        std::cerr << "There are nan values in the indicator: " << this->id << std::endl;
+        std::exit(1);
+    }
+}
+
+/**
+ * @brief Calculate several indicators over the same candles in one batch.
+ *
+ * @param indicators The indicators to calculate.
+ * @param candles The candles data.
+ * @param normalize_data Normalize the data.
+ * @return std::vector<std::vector<double>> The calculated values, one vector per indicator.
+ */
+std::vector<std::vector<double>> calculate_batch(const std::vector<Indicator *> &indicators, const std::vector<Candle> &candles, bool normalize_data)
+{
+    std::vector<std::vector<double>> results;
+    IndicatorScratch scratch;
+    calculate_batch(indicators, candles, results, scratch, normalize_data);
+    return results;
+}
+
+/**
+ * @brief Calculate several indicators over the same candles into caller-owned buffers.
+ *
+ * @param indicators The indicators to calculate.
+ * @param candles The candles data.
+ * @param results The buffers receiving the calculated values, one per indicator.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Normalize the data.
+ */
+void calculate_batch(const std::vector<Indicator *> &indicators, const std::vector<Candle> &candles, std::vector<std::vector<double>> &results, IndicatorScratch &scratch, bool normalize_data)
+{
+    // Extract the candle columns a single time for the whole batch
+    CandleSoA source = candles_to_soa(candles);
+
+    results.resize(indicators.size());
+
+#if defined(_OPENMP)
+    // The indicators are independent, so split them across threads when the
+    // build enables OpenMP (-fopenmp). Each thread carries its own scratch
+    // buffers; one indicator per thread is coarse enough that a finer split
+    // over the candles would not pay off.
+#pragma omp parallel
+    {
+        IndicatorScratch thread_scratch;
+#pragma omp for schedule(static)
+        for (long i = 0; i < static_cast<long>(indicators.size()); ++i)
+        {
+            indicators[i]->calculate_into(candles, source, results[i], thread_scratch, normalize_data);
+        }
+    }
+#else
+    for (size_t i = 0; i < indicators.size(); ++i)
+    {
+        indicators[i]->calculate_into(candles, source, results[i], scratch, normalize_data);
+    }
+#endif
+}
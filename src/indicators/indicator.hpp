@@ -1,86 +1,175 @@
-#ifndef INDICATOR_H
-#define INDICATOR_H
-
-#include <string>
-#include <vector>
-#include <functional>
-#include <utility>
-#include <regex>
-#include <variant>
-#include <unordered_map>
-#include "../types.hpp"
-
-// Define IndicatorParam as a variant of int, double, and string
-using IndicatorParam = std::variant<int, double, std::string>;
-
-// Forward declaration
-struct Candle;
-
-/**
- * @brief Check if the ID with parameters is valid.
- *
- * @param id_params The ID with parameters.
- * @param id_params_pattern The regex pattern to match the ID with parameters.
- * @return true If the ID with parameters is valid.
- */
-bool is_valid_id_with_params(const std::string &id_params, const std::string &id_params_pattern);
-
-/**
- * @brief Check if the parameters are valid with the ID pattern.
- *
- * @param id The ID.
- * @param params The parameters.
- * @param id_params_pattern The regex pattern to match the ID with parameters.
- * @return true If the parameters are valid with the ID pattern.
- */
-bool is_valid_params_with_id_params_pattern(const std::string &id, const std::vector<IndicatorParam> &params, const std::string &id_params_pattern);
-
-/**
- * @brief Class for Indicator.
- */
-class Indicator
-{
-public:
-    std::string label;                                      // The label of the indicator.
-    std::string id;                                         // The id of the indicator.
-    std::string id_params;                                  // The id of the indicator with parameters.
-    std::string id_params_pattern;                          // The regex pattern to match the ID with parameters.
-    std::unordered_map<std::string, IndicatorParam> params; // A map of the parameters.
-    std::pair<double, double> values_range;                 // The range of values.
-
-    /**
-     * @brief Construct a new Indicator::Indicator object.
-     *
-     * @param label The label of the indicator.
-     * @param id The id of the indicator.
-     * @param params The parameters of the indicator.
-     * @param values_range The range of values.
-     */
-    Indicator(std::string label, std::string id, std::unordered_map<std::string, IndicatorParam> params, std::pair<double, double> values_range = std::make_pair(0, 0));
-
-    /**
-     * @brief Calculate the indicator.
-     *
-     * @param candles The candles data.
-     * @param calculator The calculator function.
-     * @param normalize_data Normalize the data.
-     * @param values_range The range of values.
-     * @return std::vector<double> The calculated indicator values.
-     */
-    std::vector<double> calculate(const std::vector<Candle> &candles, std::function<std::vector<double>(std::vector<Candle>)> calculator, bool normalize_data = false) const;
-
-    /**
-     * @brief Calculate the indicator.
-     *
-     * @param candles The candles data.
-     * @param normalize_data Normalize the data.
-     * @param values_range The range of values.
-     * @return std::vector<double> The calculated indicator values.
-     */
-    virtual std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const;
-
-protected:
-    std::vector<double> values;
-};
-
+#ifndef INDICATOR_H
+#define INDICATOR_H
+
+#include <string>
+#include <vector>
+#include <array>
+#include <functional>
+#include <utility>
+#include <regex>
+#include <variant>
+#include <unordered_map>
+#include "../types.hpp"
+#include "../utils/aligned_allocator.hpp"
+
+// Define IndicatorParam as a variant of int, double, and string
+using IndicatorParam = std::variant<int, double, std::string>;
+
+// Forward declarations
+struct Candle;
+struct CandleSoA;
+
+/**
+ * @brief Check if the ID with parameters is valid.
+ *
+ * @param id_params The ID with parameters.
+ * @param id_params_pattern The regex pattern to match the ID with parameters.
+ * @return true If the ID with parameters is valid.
+ */
+bool is_valid_id_with_params(const std::string &id_params, const std::string &id_params_pattern);
+
+/**
+ * @brief Check if the parameters are valid with the ID pattern.
+ *
+ * @param id The ID.
+ * @param params The parameters.
+ * @param id_params_pattern The regex pattern to match the ID with parameters.
+ * @return true If the parameters are valid with the ID pattern.
+ */
+bool is_valid_params_with_id_params_pattern(const std::string &id, const std::vector<IndicatorParam> &params, const std::string &id_params_pattern);
+
+/**
+ * @brief Reusable scratch buffers shared by indicator calculations.
+ *
+ * Owning the temporary vectors here lets a batch of indicators reuse the same
+ * allocations instead of each calculate call allocating fresh vectors.
+ */
+struct IndicatorScratch
+{
+    // Maximum number of scratch buffers available to a single calculation.
+    static constexpr size_t MAX_BUFFERS = 8;
+
+    /**
+     * @brief Get a scratch buffer by index, resized and zero-filled.
+     *
+     * The buffers are stored in a fixed-size array so that the returned
+     * references stay valid when another buffer is requested afterwards.
+     *
+     * @param index The index of the buffer.
+     * @param size The required size of the buffer.
+     * @return AlignedVector<double>& The buffer.
+     */
+    AlignedVector<double> &get_buffer(size_t index, size_t size);
+
+private:
+    std::array<AlignedVector<double>, MAX_BUFFERS> buffers; // The owned buffers, cache-line aligned for the SIMD kernels.
+};
+
+/**
+ * @brief Class for Indicator.
+ */
+class Indicator
+{
+public:
+    std::string label;                                      // The label of the indicator.
+    std::string id;                                         // The id of the indicator.
+    std::string id_params;                                  // The id of the indicator with parameters.
+    std::string id_params_pattern;                          // The regex pattern to match the ID with parameters.
+    std::unordered_map<std::string, IndicatorParam> params; // A map of the parameters.
+    std::pair<double, double> values_range;                 // The range of values.
+
+    /**
+     * @brief Construct a new Indicator::Indicator object.
+     *
+     * @param label The label of the indicator.
+     * @param id The id of the indicator.
+     * @param params The parameters of the indicator.
+     * @param values_range The range of values.
+     */
+    Indicator(std::string label, std::string id, std::unordered_map<std::string, IndicatorParam> params, std::pair<double, double> values_range = std::make_pair(0, 0));
+
+    /**
+     * @brief Calculate the indicator.
+     *
+     * @param candles The candles data.
+     * @param calculator The calculator function.
+     * @param normalize_data Normalize the data.
+     * @param values_range The range of values.
+     * @return std::vector<double> The calculated indicator values.
+     */
+    std::vector<double> calculate(const std::vector<Candle> &candles, const std::function<std::vector<double>(const std::vector<Candle> &)> &calculator, bool normalize_data = false) const;
+
+    /**
+     * @brief Calculate the indicator.
+     *
+     * @param candles The candles data.
+     * @param normalize_data Normalize the data.
+     * @param values_range The range of values.
+     * @return std::vector<double> The calculated indicator values.
+     */
+    virtual std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const;
+
+    /**
+     * @brief Calculate the indicator into a caller-provided buffer.
+     *
+     * The default implementation forwards to calculate and moves the result into
+     * the output buffer. Subclasses can override it to stream the candle columns
+     * directly and reuse the scratch buffers, avoiding per-call allocations.
+     *
+     * @param candles The candles data.
+     * @param source The candles data as parallel column arrays.
+     * @param output The buffer receiving the calculated values.
+     * @param scratch The scratch buffers to reuse for temporaries.
+     * @param normalize_data Normalize the data.
+     */
+    virtual void calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data = false) const;
+
+protected:
+    std::vector<double> values;
+
+    /**
+     * @brief Calculate the indicator from the candle columns into a caller-provided buffer.
+     *
+     * Mirrors the offset, normalization and nan handling of calculate, but hands the
+     * calculator the contiguous candle columns and the shared scratch buffers so the
+     * calculation can stream only the columns it needs without allocating.
+     *
+     * @param source The candles data as parallel column arrays.
+     * @param output The buffer receiving the calculated values.
+     * @param scratch The scratch buffers to reuse for temporaries.
+     * @param calculator The calculator function, invoked with the number of candles to process.
+     * @param normalize_data Normalize the data.
+     */
+    void calculate_into(const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, const std::function<void(const CandleSoA &, size_t, std::vector<double> &, IndicatorScratch &)> &calculator, bool normalize_data) const;
+};
+
+/**
+ * @brief Calculate several indicators over the same candles in one batch.
+ *
+ * The candle columns are extracted once and the scratch buffers are shared
+ * between the indicators, so the candles are only converted a single time
+ * per batch instead of once per indicator.
+ *
+ * @param indicators The indicators to calculate.
+ * @param candles The candles data.
+ * @param normalize_data Normalize the data.
+ * @return std::vector<std::vector<double>> The calculated values, one vector per indicator.
+ */
+std::vector<std::vector<double>> calculate_batch(const std::vector<Indicator *> &indicators, const std::vector<Candle> &candles, bool normalize_data = false);
+
+/**
+ * @brief Calculate several indicators over the same candles into caller-owned buffers.
+ *
+ * Overload for hot loops: the result vectors and the scratch buffers are owned
+ * by the caller and reused from one call to the next, so repeated batches do
+ * not allocate once the buffers have reached their working size.
+ *
+ * @param indicators The indicators to calculate.
+ * @param candles The candles data.
+ * @param results The buffers receiving the calculated values, one per indicator.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Normalize the data.
+ */
+void calculate_batch(const std::vector<Indicator *> &indicators, const std::vector<Candle> &candles, std::vector<std::vector<double>> &results, IndicatorScratch &scratch, bool normalize_data = false);
+
 #endif // INDICATOR_H
\ No newline at end of file
@@ -1,9 +1,13 @@
 #include <string>
 #include <vector>
+#include <deque>
 #include <cmath>
 #include <algorithm>
 #include <iostream>
 #include <stdexcept>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 #include "../types.hpp"
 #include "../utils/math.hpp"
 #include "../utils/candles_source.hpp"
@@ -30,13 +34,13 @@ AwesomeOscillator::AwesomeOscillator(int offset) : Indicator("Awesome Oscillator
 std::vector<double> AwesomeOscillator::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             if (candles.size() < 34) {
                 return std::vector<double>(candles.size(), 0.0); // Not enough data
             }
 
-            std::vector<double> median_prices = get_candles_with_source(candles, "hl2");
+            std::vector<double> median_prices = get_candles_with_source(candles, CandleSource::HL2);
             std::vector<double> average_5 = calculate_exponential_moving_average(median_prices, 5);
             std::vector<double> average_34 = calculate_exponential_moving_average(median_prices, 34);
             std::vector<double> result = subtract_vectors(average_5, average_34);
@@ -45,6 +49,41 @@ std::vector<double> AwesomeOscillator::calculate(const std::vector<Candle> &cand
         normalize_data);
 }
 
+/**
+ * @brief Calculate the AwesomeOscillator values from the candle columns.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Boolean flag indicating whether to normalize data.
+ */
+void AwesomeOscillator::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    Indicator::calculate_into(
+        source, output, scratch, [](const CandleSoA &source, size_t count, std::vector<double> &output, IndicatorScratch &scratch)
+        {
+            if (count < 34) {
+                return; // Not enough data
+            }
+
+            // Compute the median prices (H+L)/2 into a scratch buffer, 4
+            // candles per iteration when AVX2 is available.
+            AlignedVector<double> &median_prices = scratch.get_buffer(0, count);
+            get_candles_with_source(source, CandleSource::HL2, median_prices);
+
+            AlignedVector<double> &average_5 = scratch.get_buffer(1, count);
+            AlignedVector<double> &average_34 = scratch.get_buffer(2, count);
+            calculate_exponential_moving_average(median_prices.data(), count, 5, average_5.data());
+            calculate_exponential_moving_average(median_prices.data(), count, 34, average_34.data());
+
+            for (size_t j = 0; j < count; ++j)
+            {
+                output[j] = average_5[j] - average_34[j];
+            } },
+        normalize_data);
+}
+
 // *********************************************************************************************
 
 /**
@@ -67,7 +106,7 @@ KAMA::KAMA(int er_period, int fastest_sc_period, int slowest_sc_period, int offs
 std::vector<double> KAMA::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             std::vector<double> kama_values(candles.size(), 0.0);
             int slowest_sc_period = std::get<int>(params.at("slowest_sc_period")); 
@@ -77,7 +116,7 @@ std::vector<double> KAMA::calculate(const std::vector<Candle> &candles, bool nor
                 return kama_values; // Return an empty vector if there are not enough candles
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close"); // Extract close prices from candles
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE); // Extract close prices from candles
             std::vector<double> er_values = calculate_er(closes);                               // Calculate Efficiency Ratio (ER)
             std::vector<double> sc_values = calculate_sc(er_values);                            // Calculate Smoothing Constant (SC)
 
@@ -107,16 +146,23 @@ std::vector<double> KAMA::calculate_er(const std::vector<double> &closes) const
     std::vector<double> er_values(closes.size(), 0.0);
     int er_period = std::get<int>(params.at("er_period"));
 
-    for (size_t i = er_period; i < closes.size(); ++i)
+    // Prime the rolling volatility sum over the first window
+    double volatility = 0.0;
+    for (size_t j = 1; j <= static_cast<size_t>(er_period) && j < closes.size(); ++j)
     {
-        double change = std::abs(closes[i] - closes[i - er_period]);
-        double volatility = 0.0;
-        size_t start_index = i - er_period + 1;
+        volatility += std::abs(closes[j] - closes[j - 1]);
+    }
 
-        for (size_t j = start_index; j <= i; ++j)
+    for (size_t i = er_period; i < closes.size(); ++i)
+    {
+        // Slide the window with an O(1) update: add the newest absolute change
+        // and evict the one leaving the window
+        if (i > static_cast<size_t>(er_period))
         {
-            volatility += std::abs(closes[j] - closes[j - 1]);
+            volatility += std::abs(closes[i] - closes[i - 1]) - std::abs(closes[i - er_period] - closes[i - er_period - 1]);
         }
+
+        double change = std::abs(closes[i] - closes[i - er_period]);
         er_values[i] = volatility != 0.0 ? change / volatility : 0.0;
     }
 
@@ -176,6 +222,85 @@ double KAMA::calculate_initial_kama(const std::vector<double> &closes) const
  */
 MFI::MFI(int period, int offset) : Indicator("Money Flow Index", "mfi", {{"period", period}, {"offset", offset}}, {0, 100}) {}
 
+/**
+ * @brief Calculate the Money Flow Index values from typical price and volume arrays.
+ *
+ * The Raw Money Flow is split into its positive and negative streams with
+ * comparison masks that select the flow when the typical price moved in that
+ * direction and zero it otherwise, which removes an unpredictable branch on
+ * the price direction for every candle and lets the loop process 4 doubles at
+ * a time when AVX2 is available. The period sums then slide in O(1) per
+ * candle instead of rescanning the window.
+ *
+ * @param tp The typical price values.
+ * @param volume The volume values.
+ * @param count The number of values to process.
+ * @param period The period.
+ * @param positive The buffer receiving the positive money flow values.
+ * @param negative The buffer receiving the negative money flow values.
+ * @param output The buffer receiving the MFI values.
+ */
+static void calculate_money_flow_values(const double *tp, const double *volume, size_t count, int period, double *positive, double *negative, double *output)
+{
+    size_t index = 1;
+#if defined(__AVX2__)
+    for (; index + 4 <= count; index += 4)
+    {
+        __m256d curr = _mm256_loadu_pd(&tp[index]);
+        __m256d prev = _mm256_loadu_pd(&tp[index - 1]);
+        __m256d flow = _mm256_mul_pd(curr, _mm256_loadu_pd(&volume[index]));
+        __m256d pos_mask = _mm256_cmp_pd(curr, prev, _CMP_GT_OQ);
+        __m256d neg_mask = _mm256_cmp_pd(curr, prev, _CMP_LT_OQ);
+        _mm256_storeu_pd(&positive[index], _mm256_and_pd(flow, pos_mask));
+        _mm256_storeu_pd(&negative[index], _mm256_and_pd(flow, neg_mask));
+    }
+#endif
+    for (; index < count; ++index)
+    {
+        double flow = tp[index] * volume[index];
+        positive[index] = (tp[index] > tp[index - 1]) ? flow : 0.0;
+        negative[index] = (tp[index] < tp[index - 1]) ? flow : 0.0;
+    }
+
+    double positive_sum = 0.0;
+    double negative_sum = 0.0;
+
+    // Prime the sums over the first window
+    for (size_t j = 1; j <= static_cast<size_t>(period) && j < count; ++j)
+    {
+        positive_sum += positive[j];
+        negative_sum += negative[j];
+    }
+
+    for (size_t i = period; i < count; ++i)
+    {
+        // Slide the window: add the newest flow and evict the one leaving the window
+        if (i > static_cast<size_t>(period))
+        {
+            positive_sum += positive[i] - positive[i - period];
+            negative_sum += negative[i] - negative[i - period];
+
+            // The incremental update leaves rounding residue behind; clamp it and
+            // rebuild the sums from scratch periodically so the drift stays bounded
+            positive_sum = std::max(positive_sum, 0.0);
+            negative_sum = std::max(negative_sum, 0.0);
+            if (i % 4096 == 0)
+            {
+                positive_sum = 0.0;
+                negative_sum = 0.0;
+                for (size_t j = i - period + 1; j <= i; ++j)
+                {
+                    positive_sum += positive[j];
+                    negative_sum += negative[j];
+                }
+            }
+        }
+
+        double money_flow_ratio = (negative_sum != 0.0) ? (positive_sum / negative_sum) : 0.0;
+        output[i] = 100.0 - (100.0 / (1.0 + money_flow_ratio));
+    }
+}
+
 /**
  * @brief Calculate the Money Flow Index (MFI) values.
  *
@@ -196,71 +321,47 @@ std::vector<double> MFI::calculate(const std::vector<Candle> &candles, bool norm
         return mfi_values; // Not enough data
     }
 
-    // Calculate Typical Price, Raw Money Flow, Positive Money Flow, and Negative Money Flow
-    std::vector<double> typical_prices = get_candles_with_source(candles, "hlc3");
-    std::vector<double> raw_money_flow;
-    std::vector<double> positive_money_flow;
-    std::vector<double> negative_money_flow;
+    std::vector<double> typical_prices = get_candles_with_source(candles, CandleSource::HLC3);
+    std::vector<double> volumes = get_candles_with_source(candles, CandleSource::VOLUME);
+    std::vector<double> positive_money_flow(candles.size(), 0.0);
+    std::vector<double> negative_money_flow(candles.size(), 0.0);
 
-    for (size_t i = 0; i < candles.size(); ++i)
-    {
-        double raw_flow = typical_prices[i] * candles[i].volume;
-        typical_prices.push_back(typical_prices[i]);
-        raw_money_flow.push_back(raw_flow);
+    calculate_money_flow_values(typical_prices.data(), volumes.data(), candles.size(), period, positive_money_flow.data(), negative_money_flow.data(), mfi_values.data());
 
-        if (i > 0)
-        {
-            if (typical_prices[i] > typical_prices[i - 1])
-            {
-                positive_money_flow.push_back(raw_money_flow[i]);
-                negative_money_flow.push_back(0.0);
-            }
-            else if (typical_prices[i] < typical_prices[i - 1])
-            {
-                positive_money_flow.push_back(0.0);
-                negative_money_flow.push_back(raw_money_flow[i]);
-            }
-            else
-            {
-                positive_money_flow.push_back(0.0);
-                negative_money_flow.push_back(0.0);
-            }
-        }
-        else
-        {
-            positive_money_flow.push_back(0.0);
-            negative_money_flow.push_back(0.0);
-        }
-    }
+    return mfi_values;
+}
 
-    // Calculate 14-period Positive Money Flow and Negative Money Flow
-    std::vector<double> positive_money_flow_sum;
-    std::vector<double> negative_money_flow_sum;
+/**
+ * @brief Calculate the Money Flow Index (MFI) values from the candle columns.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Boolean flag indicating whether to normalize data.
+ */
+void MFI::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    size_t count = source.size();
+    output.assign(count, 0.0);
+    int period = std::get<int>(params.at("period"));
+    int offset = std::get<int>(params.at("offset"));
 
-    for (size_t i = 0; i < candles.size(); ++i)
+    if (count < static_cast<size_t>(period + offset))
     {
-        double positive_sum = 0.0;
-        double negative_sum = 0.0;
-
-        for (size_t j = i; j > i - period; --j)
-        {
-            positive_sum += positive_money_flow[j];
-            negative_sum += negative_money_flow[j];
-        }
-
-        positive_money_flow_sum.push_back(positive_sum);
-        negative_money_flow_sum.push_back(negative_sum);
+        std::cerr << "Insufficient data to calculate Money Flow Index (MFI)." << std::endl;
+        return; // Not enough data
     }
 
-    // Calculate Money Flow Ratio and Money Flow Index
-    for (size_t i = period - 1; i < candles.size(); ++i)
-    {
-        double money_flow_ratio = (negative_money_flow_sum[i] != 0.0) ? (positive_money_flow_sum[i] / negative_money_flow_sum[i]) : 0.0;
-        double mfi = 100.0 - (100.0 / (1.0 + money_flow_ratio));
-        mfi_values[i] = mfi;
-    }
+    AlignedVector<double> &typical_prices = scratch.get_buffer(0, count);
+    AlignedVector<double> &positive_money_flow = scratch.get_buffer(1, count);
+    AlignedVector<double> &negative_money_flow = scratch.get_buffer(2, count);
 
-    return mfi_values;
+    // Compute the Typical Price (H+L+C)/3 straight from the columns, 4
+    // candles per iteration when AVX2 is available.
+    get_candles_with_source(source, CandleSource::HLC3, typical_prices);
+
+    calculate_money_flow_values(typical_prices.data(), source.volume.data(), count, period, positive_money_flow.data(), negative_money_flow.data(), output.data());
 }
 
 /**
@@ -274,6 +375,68 @@ PPO::PPO(int short_period, int long_period, int offset) : Indicator("Percentage
 {
 }
 
+/**
+ * @brief Fused kernel for the percentage oscillators (PPO and PVO).
+ *
+ * Reads each value once, carries both EMA scalars through their SMA seeds and
+ * recurrences, and writes the percentage difference directly, instead of
+ * materializing two EMA vectors and combining them in a third pass. The
+ * arithmetic matches calculate_exponential_moving_average step for step, so
+ * the fused results are identical to the multi-pass ones.
+ *
+ * @param value The accessor returning the source value at an index.
+ * @param count The number of values to process.
+ * @param short_period The short (fast) EMA period.
+ * @param long_period The long (slow) EMA period.
+ * @param output The buffer receiving the oscillator values.
+ */
+template <typename ValueAccessor>
+static void calculate_percentage_oscillator(const ValueAccessor &value, size_t count, int short_period, int long_period, double *output)
+{
+    const double alpha_short = 2.0 / (1 + short_period);
+    const double alpha_long = 2.0 / (1 + long_period);
+
+    double ema_short = 0.0;
+    double ema_long = 0.0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        double x = value(i);
+
+        // Accumulate the SMA seed until the period is reached, then run the recurrence
+        if (i < static_cast<size_t>(short_period))
+        {
+            ema_short += x;
+            if (i + 1 == static_cast<size_t>(short_period))
+            {
+                ema_short /= short_period;
+            }
+        }
+        else
+        {
+            ema_short = x * alpha_short + ema_short * (1 - alpha_short);
+        }
+
+        if (i < static_cast<size_t>(long_period))
+        {
+            ema_long += x;
+            if (i + 1 == static_cast<size_t>(long_period))
+            {
+                ema_long /= long_period;
+            }
+        }
+        else
+        {
+            ema_long = x * alpha_long + ema_long * (1 - alpha_long);
+        }
+
+        // Before a period is complete the corresponding EMA is 0, as in the vector version
+        double es = (i + 1 >= static_cast<size_t>(short_period)) ? ema_short : 0.0;
+        double el = (i + 1 >= static_cast<size_t>(long_period)) ? ema_long : 0.0;
+        output[i] = el != 0 ? ((es - el) / el) * 100.0 : 0.0;
+    }
+}
+
 /**
  * @brief Calculate the Percentage Price Oscillator (PPO) for a given set of candles.
  *
@@ -289,25 +452,46 @@ std::vector<double> PPO::calculate(const std::vector<Candle> &candles, bool norm
             int short_period = std::get<int>(params.at("short_period"));
             int long_period = std::get<int>(params.at("long_period"));
 
+            std::vector<double> ppo_values(candles.size(), 0.0); // Initialize result vector with the same size as input
+
             if (candles.size() < static_cast<size_t>(long_period)) {
-                return std::vector<double>(candles.size(), 0.0); // Not enough data
+                return ppo_values; // Not enough data
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
-            std::vector<double> short_ema = calculate_exponential_moving_average(closes, short_period);
-            std::vector<double> long_ema = calculate_exponential_moving_average(closes, long_period);
+            calculate_percentage_oscillator([&candles](size_t i)
+                                            { return candles[i].close; },
+                                            candles.size(), short_period, long_period, ppo_values.data());
 
-            std::vector<double> ppo_values(candles.size(), 0.0); // Initialize result vector with the same size as input
+            return ppo_values; },
+        normalize_data);
+}
 
-            std::vector<double> ema_diff = subtract_vectors(short_ema, long_ema);
+/**
+ * @brief Calculate the Percentage Price Oscillator (PPO) values from the candle columns.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Boolean flag indicating whether to normalize data.
+ */
+void PPO::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    Indicator::calculate_into(
+        source, output, scratch, [this](const CandleSoA &source, size_t count, std::vector<double> &output, IndicatorScratch &scratch)
+        {
+            int short_period = std::get<int>(params.at("short_period"));
+            int long_period = std::get<int>(params.at("long_period"));
 
-            for (size_t i = 0; i < candles.size(); ++i)
-            {
-                double ppo = long_ema[i] != 0 ? (ema_diff[i] / long_ema[i]) * 100.0 : 0.0;
-                ppo_values[i] = ppo; // Assign values to the appropriate index in the result vector
+            if (count < static_cast<size_t>(long_period)) {
+                return; // Not enough data
             }
 
-            return ppo_values; },
+            // Stream the close column once through the fused kernel
+            const double *closes = source.close.data();
+            calculate_percentage_oscillator([closes](size_t i)
+                                            { return closes[i]; },
+                                            count, short_period, long_period, output.data()); },
         normalize_data);
 }
 
@@ -335,38 +519,53 @@ PVO::PVO(int fast_period, int slow_period, int signal_period, int offset) : Indi
 std::vector<double> PVO::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
-            std::vector<double> volume_values = get_candles_with_source(candles, "volume");
             std::vector<double> pvo_values(candles.size(), 0.0); // Initialize result vector with the same size as input
             int fast_period = std::get<int>(params.at("fast_period"));
             int slow_period = std::get<int>(params.at("slow_period"));
 
-            if (volume_values.size() < static_cast<size_t>(slow_period)) {
+            if (candles.size() < static_cast<size_t>(slow_period)) {
                 return pvo_values;
             }
 
-            // Calculate fast EMA of volume
-            std::vector<double> fast_ema_volume = calculate_exponential_moving_average(volume_values, fast_period);
+            // Percentage difference between the fast and slow EMA of volume, fused
+            // into one streaming pass with an inline-guarded division
+            calculate_percentage_oscillator([&candles](size_t i)
+                                            { return candles[i].volume; },
+                                            candles.size(), fast_period, slow_period, pvo_values.data());
 
-            // Calculate slow EMA of volume
-            std::vector<double> slow_ema_volume = calculate_exponential_moving_average(volume_values, slow_period);
+            return pvo_values; },
 
-            // Difference between fast and slow EMA of volume
-            std::vector<double> ema_diff = subtract_vectors(fast_ema_volume, slow_ema_volume);
+        normalize_data);
+}
 
-            // Divide the difference by the slow EMA of volume
-            std::vector<double> ema_div = divide_vectors(ema_diff, slow_ema_volume);
+/**
+ * @brief Calculate the Percentage Volume Oscillator (PVO) values from the candle columns.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Boolean flag indicating whether to normalize data.
+ */
+void PVO::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    Indicator::calculate_into(
+        source, output, scratch, [this](const CandleSoA &source, size_t count, std::vector<double> &output, IndicatorScratch &scratch)
+        {
+            int fast_period = std::get<int>(params.at("fast_period"));
+            int slow_period = std::get<int>(params.at("slow_period"));
 
-            // Multiply by 100 to get the percentage
-            for (size_t i = 0; i < slow_ema_volume.size(); ++i)
-            {
-                double pvo_value = ema_div[i] * 100.0;
-                pvo_values[i] = pvo_value;
+            if (count < static_cast<size_t>(slow_period)) {
+                return; // Not enough data
             }
 
-            return pvo_values; },
-
+            // Stream the volume column once through the fused kernel
+            const double *volumes = source.volume.data();
+            calculate_percentage_oscillator([volumes](size_t i)
+                                            { return volumes[i]; },
+                                            count, fast_period, slow_period, output.data()); },
         normalize_data);
 }
 
@@ -390,7 +589,7 @@ ROC::ROC(int period, int offset) : Indicator("Rate of Change", "roc", {{"period"
 std::vector<double> ROC::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(params.at("period"));
             std::vector<double> result(candles.size(), 0.0); // Initialize result vector with the same size as input
@@ -400,7 +599,7 @@ std::vector<double> ROC::calculate(const std::vector<Candle> &candles, bool norm
                 return result; // Not enough data
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             size_t n = closes.size();
             if (n <= 1) return result; // Not enough data
 
@@ -414,6 +613,35 @@ std::vector<double> ROC::calculate(const std::vector<Candle> &candles, bool norm
         normalize_data);
 }
 
+/**
+ * @brief Calculate the Rate of Change (ROC) values from the candle columns.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Boolean flag indicating whether to normalize data.
+ */
+void ROC::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    Indicator::calculate_into(
+        source, output, scratch, [this](const CandleSoA &source, size_t count, std::vector<double> &output, IndicatorScratch &scratch)
+        {
+            int period = std::get<int>(params.at("period"));
+
+            if (count < static_cast<size_t>(period) || count <= 1) {
+                return; // Not enough data
+            }
+
+            const AlignedVector<double> &closes = source.close;
+
+            for (size_t i = period; i < count; ++i) {
+                double roc = ((closes[i] - closes[i - period]) / closes[i - period]) * 100.0;
+                output[i] = roc; // Store the ROC value
+            } },
+        normalize_data);
+}
+
 // *********************************************************************************************
 
 /**
@@ -424,6 +652,90 @@ std::vector<double> ROC::calculate(const std::vector<Candle> &candles, bool norm
  */
 RSI::RSI(int period, int offset) : Indicator("Relative Strength Index", "rsi", {{"period", period}, {"offset", offset}}, {0, 100}) {}
 
+/**
+ * @brief Core Wilder recurrence of the RSI, streaming over a close-price accessor.
+ *
+ * Templated on the period so that the common production periods get a body
+ * where the compiler folds 1/period into a constant and can unroll the seed
+ * loop. StaticPeriod 0 selects the generic body reading the runtime period.
+ *
+ * @tparam StaticPeriod The compile-time period, or 0 to use the runtime one.
+ * @param close The accessor returning the close price at an index.
+ * @param count The number of values to process.
+ * @param runtime_period The runtime period, used when StaticPeriod is 0.
+ * @param output The buffer receiving the RSI values.
+ */
+template <int StaticPeriod, typename CloseAccessor>
+static void calculate_rsi_values(const CloseAccessor &close, size_t count, int runtime_period, double *output)
+{
+    const int period = StaticPeriod > 0 ? StaticPeriod : runtime_period;
+    const double inv_period = 1.0 / period;
+
+    double gain_sum = 0.0;
+    double loss_sum = 0.0;
+
+    // Calculate initial gains and losses, extracted branchlessly from the price change
+    for (int i = 1; i <= period; ++i)
+    {
+        double diff = close(i) - close(i - 1);
+        gain_sum += 0.5 * (std::fabs(diff) + diff);
+        loss_sum += 0.5 * (std::fabs(diff) - diff);
+    }
+
+    double avg_gain = gain_sum * inv_period;
+    double avg_loss = loss_sum * inv_period;
+    double rs = (avg_loss != 0) ? (avg_gain / avg_loss) : 0;
+    double rsi = 100.0 - (100.0 / (1.0 + rs));
+    output[period] = rsi; // Store the initial RSI value
+
+    // Calculate RSI for subsequent periods in a single streaming pass over the closes
+    for (size_t i = period + 1; i < count; ++i)
+    {
+        double diff = close(i) - close(i - 1);
+        double gain = 0.5 * (std::fabs(diff) + diff);
+        double loss = 0.5 * (std::fabs(diff) - diff);
+        avg_gain = (avg_gain * (period - 1) + gain) * inv_period;
+        avg_loss = (avg_loss * (period - 1) + loss) * inv_period;
+        rs = (avg_loss != 0) ? (avg_gain / avg_loss) : 0;
+        rsi = 100.0 - (100.0 / (1.0 + rs));
+        output[i] = rsi; // Store the RSI value
+    }
+}
+
+/**
+ * @brief Dispatch the RSI calculation to the body specialized for the period.
+ *
+ * @param close The accessor returning the close price at an index.
+ * @param count The number of values to process.
+ * @param period The period.
+ * @param output The buffer receiving the RSI values.
+ */
+template <typename CloseAccessor>
+static void calculate_rsi_dispatch(const CloseAccessor &close, size_t count, int period, double *output)
+{
+    switch (period)
+    {
+    case 7:
+        calculate_rsi_values<7>(close, count, period, output);
+        break;
+    case 9:
+        calculate_rsi_values<9>(close, count, period, output);
+        break;
+    case 14:
+        calculate_rsi_values<14>(close, count, period, output);
+        break;
+    case 21:
+        calculate_rsi_values<21>(close, count, period, output);
+        break;
+    case 28:
+        calculate_rsi_values<28>(close, count, period, output);
+        break;
+    default:
+        calculate_rsi_values<0>(close, count, period, output);
+        break;
+    }
+}
+
 /**
  * @brief Calculate the Relative Strength Index (RSI) values.
  *
@@ -438,54 +750,45 @@ std::vector<double> RSI::calculate(const std::vector<Candle> &candles, bool norm
         {
             int period = std::get<int>(params.at("period"));
 
-            if (candles.size() < static_cast<size_t>(period)) {
-                return std::vector<double>(candles.size(), 0.0); // Not enough data
-            }
-
-            std::vector<double> closes = get_candles_with_source(candles, "close");
-            std::vector<double> result(closes.size(), 0.0); // Initialize result vector with the same size as input
+            std::vector<double> result(candles.size(), 0.0); // Initialize result vector with the same size as input
 
-            if (closes.size() <= static_cast<size_t>(period)) {
+            if (candles.size() <= static_cast<size_t>(period) || period == 0) {
                 return result; // Not enough data
             }
 
-            double gain_sum = 0.0;
-            double loss_sum = 0.0;
+            calculate_rsi_dispatch([&candles](size_t i)
+                                   { return candles[i].close; },
+                                   candles.size(), period, result.data());
 
-            // Calculate initial gains and losses
-            for (int i = 1; i <= period; ++i) {
-                double diff = closes[i] - closes[i - 1];
-                if (diff > 0) {
-                    gain_sum += diff;
-                }
-                else {
-                    loss_sum += std::abs(diff);
-                }
-            }
+            return result; },
 
-            double avg_gain = gain_sum / period;
-            double avg_loss = loss_sum / period;
-            double rs = (avg_loss != 0) ? (avg_gain / avg_loss) : 0;
-            double rsi = 100.0 - (100.0 / (1.0 + rs));
-            result[period] = rsi; // Store the initial RSI value
-
-            // Calculate RSI for subsequent periods
-            for (size_t i = period + 1; i < closes.size(); ++i) {
-                double diff = closes[i] - closes[i - 1];
-                double gain = (diff > 0) ? diff : 0;
-                double loss = (diff < 0) ? std::abs(diff) : 0;
-                if (period == 0) {
-                    continue; // Avoid division by zero
-                }
-                avg_gain = (avg_gain * (period - 1) + gain) / period;
-                avg_loss = (avg_loss * (period - 1) + loss) / period;
-                rs = (avg_loss != 0) ? (avg_gain / avg_loss) : 0;
-                rsi = 100.0 - (100.0 / (1.0 + rs));
-                result[i] = rsi; // Store the RSI value
-            }
+        normalize_data);
+}
 
-            return result; },
+/**
+ * @brief Calculate the Relative Strength Index (RSI) values from the candle columns.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Boolean flag indicating whether to normalize data.
+ */
+void RSI::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    Indicator::calculate_into(
+        source, output, scratch, [this](const CandleSoA &source, size_t count, std::vector<double> &output, IndicatorScratch &scratch)
+        {
+            int period = std::get<int>(params.at("period"));
 
+            if (count <= static_cast<size_t>(period) || period == 0) {
+                return; // Not enough data
+            }
+
+            const double *closes = source.close.data();
+            calculate_rsi_dispatch([closes](size_t i)
+                                   { return closes[i]; },
+                                   count, period, output.data()); },
         normalize_data);
 }
 
@@ -500,6 +803,71 @@ std::vector<double> RSI::calculate(const std::vector<Candle> &candles, bool norm
  */
 StochasticRSI::StochasticRSI(int period, int sma_period, int offset) : Indicator("Stochastic RSI", "stochastic-rsi", {{"period", period}, {"sma_period", sma_period}, {"offset", offset}}, {0, 100}) {}
 
+/**
+ * @brief Calculate the Stochastic RSI values from a close price accessor.
+ *
+ * The RSI values are produced by the shared streaming kernel, then the min and
+ * max over the last sma_period + 1 RSI values are tracked with two monotonic
+ * index deques (each bounded by the window size), so the whole pipeline runs
+ * in a single pass without rescanning the window at every bar.
+ *
+ * @param close The accessor returning the close price at an index.
+ * @param count The number of values to process.
+ * @param period The RSI period.
+ * @param sma_period The stochastic window minus one.
+ * @param rsi_values The buffer receiving the intermediate RSI values.
+ * @param output The buffer receiving the Stochastic RSI values.
+ */
+template <typename CloseAccessor>
+static void calculate_stochastic_rsi_values(const CloseAccessor &close, size_t count, int period, int sma_period, double *rsi_values, double *output)
+{
+    if (count > static_cast<size_t>(period) && period != 0)
+    {
+        calculate_rsi_dispatch(close, count, period, rsi_values);
+    }
+
+    if (count <= static_cast<size_t>(sma_period))
+    {
+        return; // Not enough data
+    }
+
+    std::deque<size_t> max_indices;
+    std::deque<size_t> min_indices;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Evict the indices that fell out of the window [i - sma_period, i]
+        while (!max_indices.empty() && max_indices.front() + sma_period < i)
+        {
+            max_indices.pop_front();
+        }
+        while (!min_indices.empty() && min_indices.front() + sma_period < i)
+        {
+            min_indices.pop_front();
+        }
+
+        // Drop the values dominated by the incoming one to keep the deques monotonic
+        while (!max_indices.empty() && rsi_values[max_indices.back()] <= rsi_values[i])
+        {
+            max_indices.pop_back();
+        }
+        while (!min_indices.empty() && rsi_values[min_indices.back()] >= rsi_values[i])
+        {
+            min_indices.pop_back();
+        }
+
+        max_indices.push_back(i);
+        min_indices.push_back(i);
+
+        if (i >= static_cast<size_t>(sma_period))
+        {
+            double max_rsi = rsi_values[max_indices.front()];
+            double min_rsi = rsi_values[min_indices.front()];
+            output[i] = (max_rsi - min_rsi) > 0 ? (rsi_values[i] - min_rsi) / (max_rsi - min_rsi) * 100.0 : 0.0;
+        }
+    }
+}
+
 /**
  * @brief Calculate the Stochastic Relative Strength Index (Stoch RSI) values.
  *
@@ -515,34 +883,44 @@ std::vector<double> StochasticRSI::calculate(const std::vector<Candle> &candles,
             int period = std::get<int>(params.at("period"));
             int sma_period = std::get<int>(params.at("sma_period"));
 
-            if (candles.size() < static_cast<size_t>(period)) {
-                return std::vector<double>(candles.size(), 0.0); // Not enough data
-            }
-
-            // Calculate RSI values using the RelativeStrengthIndex class
-            RSI rsi(period);
-            std::vector<double> rsi_values = rsi.calculate(candles, false);
-
-            // Calculate Stochastic RSI values
+            std::vector<double> rsi_values(candles.size(), 0.0);
             std::vector<double> result(candles.size(), 0.0); // Initialize result vector with the same size as input
-            size_t n = rsi_values.size();
-            if (n <= static_cast<size_t>(sma_period)) {
-                return result; // Not enough data
-            }
 
-            for (size_t i = sma_period; i < n; ++i)
-            {
-                double max_rsi = *std::max_element(rsi_values.begin() + (i - sma_period), rsi_values.begin() + i + 1);
-                double min_rsi = *std::min_element(rsi_values.begin() + (i - sma_period), rsi_values.begin() + i + 1);
-                double stoch_rsi = (max_rsi - min_rsi) > 0 ? (rsi_values[i] - min_rsi) / (max_rsi - min_rsi) * 100.0 : 0.0;
-                result[i] = stoch_rsi; // Store the Stochastic RSI value
-            }
+            calculate_stochastic_rsi_values([&candles](size_t i)
+                                            { return candles[i].close; },
+                                            candles.size(), period, sma_period, rsi_values.data(), result.data());
 
             return result; },
 
         normalize_data);
 }
 
+/**
+ * @brief Calculate the Stochastic Relative Strength Index (Stoch RSI) values from the candle columns.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Boolean flag indicating whether to normalize data.
+ */
+void StochasticRSI::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    Indicator::calculate_into(
+        source, output, scratch, [this](const CandleSoA &source, size_t count, std::vector<double> &output, IndicatorScratch &scratch)
+        {
+            int period = std::get<int>(params.at("period"));
+            int sma_period = std::get<int>(params.at("sma_period"));
+
+            AlignedVector<double> &rsi_values = scratch.get_buffer(0, count);
+
+            const double *closes = source.close.data();
+            calculate_stochastic_rsi_values([closes](size_t i)
+                                            { return closes[i]; },
+                                            count, period, sma_period, rsi_values.data(), output.data()); },
+        normalize_data);
+}
+
 // *********************************************************************************************
 
 /**
@@ -585,17 +963,18 @@ std::vector<double> StochasticOscillator::calculate(const std::vector<Candle> &c
                 return result; // Not enough data
             }
 
-            std::vector<double> all_highs = get_candles_with_source(candles, "high");
-            std::vector<double> all_lows = get_candles_with_source(candles, "low");
+            std::vector<double> all_highs = get_candles_with_source(candles, CandleSource::HIGH);
+            std::vector<double> all_lows = get_candles_with_source(candles, CandleSource::LOW);
+
+            // Calculate the window extrema in one pass instead of rescanning the window for every candle
+            std::vector<double> highest_highs = calculate_rolling_max(all_highs, d_period);
+            std::vector<double> lowest_lows = calculate_rolling_min(all_lows, d_period);
 
             for (size_t i = d_period - 1; i < n; ++i)
             {
-                std::vector<double> highs = std::vector<double>(all_highs.begin() + (i - d_period + 1), all_highs.begin() + i + 1);
-                std::vector<double> lows = std::vector<double>(all_lows.begin() + (i - d_period + 1), all_lows.begin() + i + 1);
-
                 // Calculate %K value
-                double highest_high = *std::max_element(highs.begin(), highs.end());
-                double lowest_low = *std::min_element(lows.begin(), lows.end());
+                double highest_high = highest_highs[i];
+                double lowest_low = lowest_lows[i];
                 double stochastic_k = (highest_high - lowest_low) > 0 ? 100.0 * (candles[i].close - lowest_low) / (highest_high - lowest_low) : 0.0;
 
                 // Add %K value to result
@@ -671,6 +1050,76 @@ std::vector<double> TSI::calculate(const std::vector<Candle> &candles, bool norm
         normalize_data);
 }
 
+/**
+ * @brief Calculate the True Strength Index (TSI) values from the candle columns.
+ *
+ * @param candles The candles data.
+ * @param source The candles data as parallel column arrays.
+ * @param output The buffer receiving the calculated values.
+ * @param scratch The scratch buffers to reuse for temporaries.
+ * @param normalize_data Boolean flag indicating whether to normalize data.
+ */
+void TSI::calculate_into(const std::vector<Candle> &candles, const CandleSoA &source, std::vector<double> &output, IndicatorScratch &scratch, bool normalize_data) const
+{
+    Indicator::calculate_into(
+        source, output, scratch, [this](const CandleSoA &source, size_t count, std::vector<double> &output, IndicatorScratch &scratch)
+        {
+            int short_period = std::get<int>(params.at("short_period"));
+            int long_period = std::get<int>(params.at("long_period"));
+
+            if (count < static_cast<size_t>(long_period)) {
+                return; // Not enough data
+            }
+
+            const AlignedVector<double> &closes = source.close;
+
+            // Calculate price change and absolute price change in the scratch
+            // buffers. The absolute value is taken by clearing the sign bit, so
+            // the loop carries no branch and is processed 4 doubles at a time
+            // when AVX2 is available.
+            AlignedVector<double> &price_change = scratch.get_buffer(0, count);
+            AlignedVector<double> &absolute_price_change = scratch.get_buffer(1, count);
+            const double *closes_data = closes.data();
+            double *pc = price_change.data();
+            double *apc = absolute_price_change.data();
+            size_t i = 1;
+#if defined(__AVX2__)
+            const __m256d sign_bit = _mm256_set1_pd(-0.0);
+            for (; i + 4 <= count; i += 4)
+            {
+                __m256d diff = _mm256_sub_pd(_mm256_loadu_pd(&closes_data[i]), _mm256_loadu_pd(&closes_data[i - 1]));
+                _mm256_storeu_pd(&pc[i], diff);
+                _mm256_storeu_pd(&apc[i], _mm256_andnot_pd(sign_bit, diff));
+            }
+#endif
+            for (; i < count; ++i) {
+                double diff = closes_data[i] - closes_data[i - 1];
+                pc[i] = diff;
+                apc[i] = std::abs(diff);
+            }
+
+            // Calculate double smoothed price change and double smoothed
+            // absolute price change with the buffer-based EMA primitive, so
+            // the four smoothing stages run on reused scratch instead of
+            // allocating a vector each
+            AlignedVector<double> &first_smoothed = scratch.get_buffer(2, count);
+            AlignedVector<double> &second_smoothed_pc = scratch.get_buffer(3, count);
+            AlignedVector<double> &second_smoothed_absolute_pc = scratch.get_buffer(4, count);
+
+            calculate_exponential_moving_average(pc, count, long_period, first_smoothed.data());
+            calculate_exponential_moving_average(first_smoothed.data(), count, short_period, second_smoothed_pc.data());
+
+            calculate_exponential_moving_average(apc, count, long_period, first_smoothed.data());
+            calculate_exponential_moving_average(first_smoothed.data(), count, short_period, second_smoothed_absolute_pc.data());
+
+            // Calculate TSI
+            for (size_t i = 0; i < count; ++i) {
+                double tsi = second_smoothed_absolute_pc[i] != 0 ? 100.0 * (second_smoothed_pc[i] / second_smoothed_absolute_pc[i]) : 0.0;
+                output[i] = tsi;
+            } },
+        normalize_data);
+}
+
 // *********************************************************************************************
 
 /**
@@ -771,11 +1220,11 @@ std::vector<double> WPR::calculate(const std::vector<Candle> &candles, bool norm
                 return result; // Not enough data
             }
 
-            HighestHigh highest_source(period, 0);
-            LowestLow lowest_source(period, 0);
-
-            std::vector<double> highest_highs = highest_source.calculate(candles, false);
-            std::vector<double> lowest_lows = lowest_source.calculate(candles, false);
+            // Calculate the window extrema in one pass instead of rescanning the window for every
+            // candle. The window of period bars to the left plus the current one matches the
+            // HighestHigh/LowestLow indicators previously used here.
+            std::vector<double> highest_highs = calculate_rolling_max(get_candles_with_source(candles, CandleSource::HIGH), period + 1);
+            std::vector<double> lowest_lows = calculate_rolling_min(get_candles_with_source(candles, CandleSource::LOW), period + 1);
 
             for (size_t i = period - 1; i < candles.size(); ++i)
             {
@@ -790,3 +1239,107 @@ std::vector<double> WPR::calculate(const std::vector<Candle> &candles, bool norm
 
         normalize_data);
 }
+
+// *********************************************************************************************
+
+/**
+ * @brief Create a momentum indicator from its ID.
+ *
+ * The caller owns the returned indicator. Invalid parameters propagate as
+ * std::invalid_argument to the outer driver (create_indicator_from_id), which
+ * reports them and returns nullptr, instead of killing the process here.
+ *
+ * @param id The ID of the indicator.
+ * @param params The parameters of the indicator.
+ * @return Indicator* The indicator, or nullptr if the ID is not a momentum indicator.
+ * @throws std::invalid_argument If the parameters do not match the indicator.
+ */
+Indicator *create_momentum_indicator(const std::string &id, std::unordered_map<std::string, IndicatorParam> params)
+{
+    if (id == "awesome-oscillator")
+    {
+        if (check_params(params, {{"offset", typeid(int)}}))
+        {
+            return new AwesomeOscillator(std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "kama")
+    {
+        if (check_params(params, {{"er_period", typeid(int)}, {"fastest_sc_period", typeid(int)}, {"slowest_sc_period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new KAMA(std::get<int>(params["er_period"]), std::get<int>(params["fastest_sc_period"]), std::get<int>(params["slowest_sc_period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "mfi")
+    {
+        if (check_params(params, {{"period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new MFI(std::get<int>(params["period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "ppo")
+    {
+        if (check_params(params, {{"short_period", typeid(int)}, {"long_period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new PPO(std::get<int>(params["short_period"]), std::get<int>(params["long_period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "pvo")
+    {
+        if (check_params(params, {{"fast_period", typeid(int)}, {"slow_period", typeid(int)}, {"signal_period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new PVO(std::get<int>(params["fast_period"]), std::get<int>(params["slow_period"]), std::get<int>(params["signal_period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "roc")
+    {
+        if (check_params(params, {{"period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new ROC(std::get<int>(params["period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "rsi")
+    {
+        if (check_params(params, {{"period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new RSI(std::get<int>(params["period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "stochastic-rsi")
+    {
+        if (check_params(params, {{"period", typeid(int)}, {"sma_period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new StochasticRSI(std::get<int>(params["period"]), std::get<int>(params["sma_period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "stochastic-oscillator")
+    {
+        if (check_params(params, {{"k_period", typeid(int)}, {"d_period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new StochasticOscillator(std::get<int>(params["k_period"]), std::get<int>(params["d_period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "tsi")
+    {
+        if (check_params(params, {{"short_period", typeid(int)}, {"long_period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new TSI(std::get<int>(params["short_period"]), std::get<int>(params["long_period"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "uo")
+    {
+        if (check_params(params, {{"period1", typeid(int)}, {"period2", typeid(int)}, {"period3", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new UO(std::get<int>(params["period1"]), std::get<int>(params["period2"]), std::get<int>(params["period3"]), std::get<int>(params["offset"]));
+        }
+    }
+    else if (id == "wpr")
+    {
+        if (check_params(params, {{"period", typeid(int)}, {"offset", typeid(int)}}))
+        {
+            return new WPR(std::get<int>(params["period"]), std::get<int>(params["offset"]));
+        }
+    }
+
+    return nullptr;
+}
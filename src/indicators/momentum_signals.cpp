@@ -21,7 +21,7 @@ AwesomeOscillatorSignal::AwesomeOscillatorSignal(int offset) : Indicator("Awesom
 std::vector<double> AwesomeOscillatorSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int offset = std::get<int>(this->params.at("offset"));
 
@@ -66,7 +66,7 @@ KAMASignal::KAMASignal(int er_period, int fastest_sc_period, int slowest_sc_peri
 std::vector<double> KAMASignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int er_period = std::get<int>(this->params.at("er_period"));
             int fastest_sc_period = std::get<int>(this->params.at("fastest_sc_period"));
@@ -114,7 +114,7 @@ MFISignal::MFISignal(int period, int overbought, int oversold, int offset) : Ind
 std::vector<double> MFISignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int overbought = std::get<int>(this->params.at("overbought"));
@@ -161,7 +161,7 @@ PPOSignal::PPOSignal(int short_period, int long_period, int offset) : Indicator(
 std::vector<double> PPOSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int short_period = std::get<int>(this->params.at("short_period"));
             int long_period = std::get<int>(this->params.at("long_period"));
@@ -206,7 +206,7 @@ ROCSignal::ROCSignal(int period, int offset) : Indicator("Rate of Change (Signal
 std::vector<double> ROCSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int offset = std::get<int>(this->params.at("offset"));
@@ -250,7 +250,7 @@ RSISignal::RSISignal(int period, int overbought, int oversold, int offset) : Ind
 std::vector<double> RSISignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int overbought = std::get<int>(this->params.at("overbought"));
@@ -298,7 +298,7 @@ StochasticRSISignal::StochasticRSISignal(int period, int overbought, int oversol
 std::vector<double> StochasticRSISignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int overbought = std::get<int>(this->params.at("overbought"));
@@ -347,7 +347,7 @@ StochasticOscillatorSignal::StochasticOscillatorSignal(int k_period, int d_perio
 std::vector<double> StochasticOscillatorSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int k_period = std::get<int>(this->params.at("k_period"));
             int d_period = std::get<int>(this->params.at("d_period"));
@@ -397,7 +397,7 @@ TSISignal::TSISignal(int short_period, int long_period, int overbought, int over
 std::vector<double> TSISignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int short_period = std::get<int>(this->params.at("short_period"));
             int long_period = std::get<int>(this->params.at("long_period"));
@@ -448,7 +448,7 @@ UOSignal::UOSignal(int short_period, int medium_period, int long_period, int ove
 std::vector<double> UOSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int short_period = std::get<int>(this->params.at("short_period"));
             int medium_period = std::get<int>(this->params.at("medium_period"));
@@ -498,7 +498,7 @@ WPRSignal::WPRSignal(int period, int overbought, int oversold, int offset) : Ind
 std::vector<double> WPRSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int overbought = std::get<int>(this->params.at("overbought"));
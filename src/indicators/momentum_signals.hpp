@@ -280,7 +280,7 @@ public:
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> momentum_signals_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> momentum_signals_indicators_map = {
     {"awesome-oscillator-signal", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
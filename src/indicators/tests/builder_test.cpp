@@ -19,14 +19,12 @@ TEST(BuilderTest, ExtractParameters)
 TEST(BuilderTest, CheckParams)
 {
     std::unordered_map<std::string, IndicatorParam> parameters = {{"period", 14}, {"source", "close"}};
-    std::unordered_map<std::string, std::type_index> required_params = {{"period", typeid(int)}, {"source", typeid(std::string)}};
 
-    ASSERT_TRUE(check_params(parameters, required_params));
+    ASSERT_TRUE(check_params(parameters, {{"period", typeid(int)}, {"source", typeid(std::string)}}));
 
     parameters = {{"period", 14}};
-    required_params = {{"period", typeid(int)}, {"source", typeid(std::string)}};
 
-    ASSERT_THROW(check_params(parameters, required_params), std::invalid_argument);
+    ASSERT_THROW(check_params(parameters, {{"period", typeid(int)}, {"source", typeid(std::string)}}), std::invalid_argument);
 }
 
 TEST(BuilderTest, CreateIndicatorFromId)
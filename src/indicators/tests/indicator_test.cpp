@@ -7,45 +7,60 @@
 #include <iomanip>
 #include <string>
 #include "../../types.hpp"
+#include "../../utils/candles_source.hpp"
 #include "../indicator.hpp"
+#include "../momentum.hpp"
 
 // Test fixture for Indicator class
 class IndicatorTest : public ::testing::Test
 {
 protected:
-    // Common setup code, executed before each test
-    void SetUp() override
+    /**
+     * @brief Get the shared mock candles.
+     *
+     * The mock data is built once and shared across the tests instead of
+     * being rebuilt in SetUp() before every test. No test mutates the
+     * candles, so the shared vector stays constant.
+     *
+     * @return const std::vector<Candle> & The mock candles.
+     */
+    static const std::vector<Candle> &get_mock_candles()
     {
-        // Define a tm struct with the desired date and time
-        std::tm timeInfo = {
-            .tm_sec = 0,
-            .tm_min = 0,
-            .tm_hour = 0,
-            .tm_mday = 1,
-            .tm_mon = 1,
-            .tm_year = 2023 - 1900,
-        };
-
-        // Convert tm struct to time_t
-        time_t date = std::mktime(&timeInfo);
-
-        // Mock data initialization
-        mock_candles = {
-            Candle{.date = date, .open = 10, .high = 12, .low = 8, .close = 15},
-            Candle{.date = date, .open = 15, .high = 16, .low = 8, .close = 9},
-            Candle{.date = date, .open = 9, .high = 10, .low = 6, .close = 12},
-            Candle{.date = date, .open = 12, .high = 13, .low = 8, .close = 6},
-            Candle{.date = date, .open = 6, .high = 7, .low = 5, .close = 5},
-            Candle{.date = date, .open = 8, .high = 17, .low = 5, .close = 17},
-            Candle{.date = date, .open = 17, .high = 18, .low = 6, .close = 14},
-            Candle{.date = date, .open = 14, .high = 15, .low = 8, .close = 11},
-            Candle{.date = date, .open = 11, .high = 12, .low = 2, .close = 4},
-            Candle{.date = date, .open = 4, .high = 21, .low = 8, .close = 20},
-            Candle{.date = date, .open = 20, .high = 20, .low = 5, .close = 18}};
+        static const std::vector<Candle> candles = []
+        {
+            // Define a tm struct with the desired date and time
+            std::tm timeInfo = {
+                .tm_sec = 0,
+                .tm_min = 0,
+                .tm_hour = 0,
+                .tm_mday = 1,
+                .tm_mon = 1,
+                .tm_year = 2023 - 1900,
+            };
+
+            // Convert tm struct to time_t
+            time_t date = std::mktime(&timeInfo);
+
+            // Mock data initialization
+            return std::vector<Candle>{
+                Candle{.date = date, .open = 10, .high = 12, .low = 8, .close = 15},
+                Candle{.date = date, .open = 15, .high = 16, .low = 8, .close = 9},
+                Candle{.date = date, .open = 9, .high = 10, .low = 6, .close = 12},
+                Candle{.date = date, .open = 12, .high = 13, .low = 8, .close = 6},
+                Candle{.date = date, .open = 6, .high = 7, .low = 5, .close = 5},
+                Candle{.date = date, .open = 8, .high = 17, .low = 5, .close = 17},
+                Candle{.date = date, .open = 17, .high = 18, .low = 6, .close = 14},
+                Candle{.date = date, .open = 14, .high = 15, .low = 8, .close = 11},
+                Candle{.date = date, .open = 11, .high = 12, .low = 2, .close = 4},
+                Candle{.date = date, .open = 4, .high = 21, .low = 8, .close = 20},
+                Candle{.date = date, .open = 20, .high = 20, .low = 5, .close = 18}};
+        }();
+
+        return candles;
     }
 
     // Common member variables
-    std::vector<Candle> mock_candles;
+    const std::vector<Candle> &mock_candles = get_mock_candles();
 };
 
 // Test case for Indicator::calculate method
@@ -58,6 +73,7 @@ TEST_F(IndicatorTest, Calculate)
     auto calculator = [](std::vector<Candle> candles) -> std::vector<double>
     {
         std::vector<double> values;
+        values.reserve(candles.size());
         for (const auto &candle : candles)
         {
             values.push_back(candle.close); // Just return close prices as indicator values for testing
@@ -88,6 +104,7 @@ TEST_F(IndicatorTest, CalculateWithOffset)
     auto calculator = [](std::vector<Candle> candles) -> std::vector<double>
     {
         std::vector<double> values;
+        values.reserve(candles.size());
         for (const auto &candle : candles)
         {
             values.push_back(candle.close); // Just return close prices as indicator values for testing
@@ -112,6 +129,7 @@ TEST_F(IndicatorTest, NormalizeData)
     auto calculator = [](std::vector<Candle> candles) -> std::vector<double>
     {
         std::vector<double> values;
+        values.reserve(candles.size());
         for (const auto &candle : candles)
         {
             values.push_back(candle.close); // Just return close prices as indicator values for testing
@@ -133,6 +151,78 @@ TEST_F(IndicatorTest, NormalizeData)
     }
 }
 
+// Test case for the calculate_batch free function
+TEST_F(IndicatorTest, CalculateBatch)
+{
+    RSI rsi(5);
+    ROC roc(5);
+    PPO ppo(3, 5);
+    PVO pvo(3, 5);
+    TSI tsi(3, 5);
+    RSI rsi_with_offset(5, 2);
+    AwesomeOscillator awesome_oscillator;
+    std::vector<Indicator *> indicators = {&rsi, &roc, &ppo, &pvo, &tsi, &rsi_with_offset, &awesome_oscillator};
+
+    // Calculate the indicators in one batch over the candles
+    std::vector<std::vector<double>> batch_results = calculate_batch(indicators, mock_candles, false);
+
+    // Check that the batch produces one result vector per indicator
+    ASSERT_EQ(batch_results.size(), indicators.size());
+
+    // Check that the batch results match the individual calculate results
+    for (size_t i = 0; i < indicators.size(); ++i)
+    {
+        std::vector<double> expected = indicators[i]->calculate(mock_candles, false);
+        ASSERT_EQ(batch_results[i], expected);
+    }
+
+    // Check that the caller-owned overload reuses its buffers across calls and
+    // produces the same values
+    std::vector<std::vector<double>> reused_results;
+    IndicatorScratch scratch;
+    calculate_batch(indicators, mock_candles, reused_results, scratch, false);
+    calculate_batch(indicators, mock_candles, reused_results, scratch, false);
+    ASSERT_EQ(reused_results, batch_results);
+}
+
+// Test case for the conversion of candles to a structure of arrays
+TEST_F(IndicatorTest, CandlesToSoA)
+{
+    CandleSoA source = candles_to_soa(mock_candles);
+
+    // Check that every column has the same size as the input candles
+    ASSERT_EQ(source.size(), mock_candles.size());
+
+    // Check that the columns contain the candle fields
+    for (size_t i = 0; i < mock_candles.size(); ++i)
+    {
+        ASSERT_EQ(source.open[i], mock_candles[i].open);
+        ASSERT_EQ(source.high[i], mock_candles[i].high);
+        ASSERT_EQ(source.low[i], mock_candles[i].low);
+        ASSERT_EQ(source.close[i], mock_candles[i].close);
+        ASSERT_EQ(source.volume[i], mock_candles[i].volume);
+    }
+}
+
+// Test case for the conversion of candles to a structure of float32 arrays
+TEST_F(IndicatorTest, CandlesToSoAf)
+{
+    CandleSoAf source = candles_to_soa_f(mock_candles);
+
+    // Check that every column has the same size as the input candles
+    ASSERT_EQ(source.size(), mock_candles.size());
+
+    // Check that the columns contain the candle fields
+    for (size_t i = 0; i < mock_candles.size(); ++i)
+    {
+        ASSERT_FLOAT_EQ(source.open[i], mock_candles[i].open);
+        ASSERT_FLOAT_EQ(source.high[i], mock_candles[i].high);
+        ASSERT_FLOAT_EQ(source.low[i], mock_candles[i].low);
+        ASSERT_FLOAT_EQ(source.close[i], mock_candles[i].close);
+        ASSERT_FLOAT_EQ(source.volume[i], mock_candles[i].volume);
+    }
+}
+
 TEST_F(IndicatorTest, IsValidIdWithParams)
 {
     std::string id_params = "test-indicator-1-2.5-abc";
@@ -249,3 +249,42 @@ TEST(TimeIndicatorsTest, WeekDay)
     ASSERT_NE(created_saturday, nullptr);
     ASSERT_EQ(created_saturday->calculate(test_candles_weekday), result_saturday);
 }
+
+TEST(TimeIndicatorsTest, ByteVariants)
+{
+    // Create candles spanning a day so every indicator produces a mix of values
+    std::vector<Candle> test_candles;
+    for (int h = 0; h < 24; ++h)
+    {
+        tm datetime = {0};
+        datetime.tm_year = 2023 - 1900;
+        datetime.tm_mon = 0;
+        datetime.tm_mday = 1;
+        datetime.tm_hour = h;
+        datetime.tm_min = h * 2;
+        time_t date = mktime(&datetime);
+        test_candles.push_back({date, 1, 1, 1, 1, 0, 0, 0});
+    }
+
+    Hour hour;
+    Minute minute;
+    NFPWeek nfp_week;
+    MarketSession london("london");
+    WeekDay sunday("sunday");
+    Hour hour_with_offset(2);
+
+    // The expanded byte outputs must match the double outputs
+    std::vector<double> expanded;
+    expand_u8_to_double(hour.calculate_u8(test_candles), expanded);
+    ASSERT_EQ(expanded, hour.calculate(test_candles, false));
+    expand_u8_to_double(minute.calculate_u8(test_candles), expanded);
+    ASSERT_EQ(expanded, minute.calculate(test_candles, false));
+    expand_u8_to_double(nfp_week.calculate_u8(test_candles), expanded);
+    ASSERT_EQ(expanded, nfp_week.calculate(test_candles, false));
+    expand_u8_to_double(london.calculate_u8(test_candles), expanded);
+    ASSERT_EQ(expanded, london.calculate(test_candles, false));
+    expand_u8_to_double(sunday.calculate_u8(test_candles), expanded);
+    ASSERT_EQ(expanded, sunday.calculate(test_candles, false));
+    expand_u8_to_double(hour_with_offset.calculate_u8(test_candles), expanded);
+    ASSERT_EQ(expanded, hour_with_offset.calculate(test_candles, false));
+}
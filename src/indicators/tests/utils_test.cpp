@@ -20,6 +20,56 @@ TEST(IndicatorsUtilsTest, SimpleMovingAverage)
     ASSERT_EQ(sma, expected_sma);
 }
 
+TEST(IndicatorsUtilsTest, FloatMovingAverages)
+{
+    // Compare the float32 overloads against the double versions on a longer
+    // series so the vectorized blocks are exercised as well
+    std::vector<double> values;
+    std::vector<float> values_f;
+    for (int i = 0; i < 32; ++i)
+    {
+        double value = 10.0 + std::sin(i * 0.7) * 3.0;
+        values.push_back(value);
+        values_f.push_back(static_cast<float>(value));
+    }
+    int period = 3;
+
+    std::vector<double> sma = calculate_simple_moving_average(values, period);
+    std::vector<float> sma_f = calculate_simple_moving_average(values_f, period);
+    std::vector<double> ema = calculate_exponential_moving_average(values, period);
+    std::vector<float> ema_f = calculate_exponential_moving_average(values_f, period);
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_NEAR(sma_f[i], sma[i], 1e-3);
+        ASSERT_NEAR(ema_f[i], ema[i], 1e-3);
+    }
+}
+
+TEST(IndicatorsUtilsTest, RollingMax)
+{
+    std::vector<double> values = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    int period = 3;
+
+    std::vector<double> expected_max = {3, 3, 4, 4, 5, 9, 9, 9, 6, 6, 5}; // Expected rolling maximum values
+
+    std::vector<double> rolling_max = calculate_rolling_max(values, period);
+
+    ASSERT_EQ(rolling_max, expected_max);
+}
+
+TEST(IndicatorsUtilsTest, RollingMin)
+{
+    std::vector<double> values = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    int period = 3;
+
+    std::vector<double> expected_min = {3, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3}; // Expected rolling minimum values
+
+    std::vector<double> rolling_min = calculate_rolling_min(values, period);
+
+    ASSERT_EQ(rolling_min, expected_min);
+}
+
 TEST(IndicatorsUtilsTest, ExponentialMovingAverage)
 {
     std::vector<double> values = {2, 4, 6, 8, 12, 14, 16, 18, 20};
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <vector>
+#include <cstdint>
 #include <unordered_map>
 #include <functional>
 #include <stdexcept>
@@ -11,6 +12,45 @@
 #include "../types.hpp"
 #include "indicator.hpp"
 
+/**
+ * @brief Calendar fields of a candle series.
+ */
+struct DecodedTimeFields
+{
+    std::vector<int> hours;   // Hour of the day (0-23).
+    std::vector<int> minutes; // Minute of the hour (0-59).
+    std::vector<int> mdays;   // Day of the month (1-31).
+    std::vector<int> wdays;   // Day of the week (Sunday is 0).
+};
+
+/**
+ * @brief Decode the candle dates into calendar fields in a single pass.
+ *
+ * Every time indicator needs the decoded date of every candle, so instead of
+ * each one walking the candles and decoding independently, the fields are
+ * decoded once per candle series and cached. A batch running several time
+ * indicators over the same candles decodes the dates a single time and the
+ * indicators read the field they need from the shared result.
+ *
+ * @param candles Vector of Candle data.
+ * @return const DecodedTimeFields & The decoded calendar fields.
+ */
+const DecodedTimeFields &decode_time_fields(const std::vector<Candle> &candles);
+
+/**
+ * @brief Expand byte values to doubles.
+ *
+ * Converts the compact byte output of the calculate_u8 variants back to
+ * doubles at the consumer boundary, 4 values per iteration when AVX2 is
+ * available.
+ *
+ * @param values The byte values.
+ * @param output The buffer receiving the values as doubles.
+ */
+void expand_u8_to_double(const std::vector<uint8_t> &values, std::vector<double> &output);
+
+// *********************************************************************************************
+
 /**
  * @brief Class for Hour indicator.
  */
@@ -32,6 +72,18 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+    /**
+     * @brief Calculate the Hour values as bytes.
+     *
+     * The hour fits in a byte, so the byte output packs 8x more values per
+     * cache line than calculate. Normalization is left to the consumer; use
+     * expand_u8_to_double at the boundary that needs doubles.
+     *
+     * @param candles Vector of Candle data.
+     * @return std::vector<uint8_t> Vector containing calculated values.
+     */
+    std::vector<uint8_t> calculate_u8(const std::vector<Candle> &candles) const;
 };
 
 // *********************************************************************************************
@@ -57,6 +109,18 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+    /**
+     * @brief Calculate the Minute values as bytes.
+     *
+     * The minute fits in a byte, so the byte output packs 8x more values per
+     * cache line than calculate. Normalization is left to the consumer; use
+     * expand_u8_to_double at the boundary that needs doubles.
+     *
+     * @param candles Vector of Candle data.
+     * @return std::vector<uint8_t> Vector containing calculated values.
+     */
+    std::vector<uint8_t> calculate_u8(const std::vector<Candle> &candles) const;
 };
 
 // *********************************************************************************************
@@ -78,6 +142,18 @@ public:
      * @return std::vector<double> Vector containing 1 if the candle is on NFP week, 0 otherwise.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+    /**
+     * @brief Check if the candle is on NFP week, as bytes.
+     *
+     * The 0/1 flag fits in a byte, so the byte output packs 8x more values
+     * per cache line than calculate. Use expand_u8_to_double at the boundary
+     * that needs doubles.
+     *
+     * @param candles Vector of Candle data.
+     * @return std::vector<uint8_t> Vector containing 1 if the candle is on NFP week, 0 otherwise.
+     */
+    std::vector<uint8_t> calculate_u8(const std::vector<Candle> &candles) const;
 };
 
 // *********************************************************************************************
@@ -101,6 +177,21 @@ public:
      * @return std::vector<double> Vector containing 1 if the candle is on the market session, 0 otherwise.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+    /**
+     * @brief Check if the candle is on a market session, as bytes.
+     *
+     * The 0/1 flag fits in a byte, so the byte output packs 8x more values
+     * per cache line than calculate. Use expand_u8_to_double at the boundary
+     * that needs doubles.
+     *
+     * @param candles Vector of Candle data.
+     * @return std::vector<uint8_t> Vector containing 1 if the candle is on the market session, 0 otherwise.
+     */
+    std::vector<uint8_t> calculate_u8(const std::vector<Candle> &candles) const;
+
+private:
+    uint32_t session_mask; // Bitmask with one bit set per session hour, resolved from the zone at construction
 };
 
 // *********************************************************************************************
@@ -123,9 +214,24 @@ public:
      * @return std::vector<double> Vector containing the number of each candle day (0-6).
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+    /**
+     * @brief Check if the candle is on the week day, as bytes.
+     *
+     * The 0/1 flag fits in a byte, so the byte output packs 8x more values
+     * per cache line than calculate. Use expand_u8_to_double at the boundary
+     * that needs doubles.
+     *
+     * @param candles Vector of Candle data.
+     * @return std::vector<uint8_t> Vector containing 1 if the candle is on the week day, 0 otherwise.
+     */
+    std::vector<uint8_t> calculate_u8(const std::vector<Candle> &candles) const;
+
+private:
+    int attempt_day; // Weekday number (Sunday is 0), resolved from the day name at construction
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> time_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> time_indicators_map = {
     {"hour", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
@@ -29,7 +29,7 @@ ADX::ADX(int period, int offset) : Indicator("Average Directional Index", "adx",
 std::vector<double> ADX::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> adx_values(candles.size(), 0.0); // Initialize adx_values with the same size as input vectors
             int period = std::get<int>(this->params.at("period"));
@@ -188,7 +188,7 @@ AroonUp::AroonUp(int period, int offset) : Indicator("Aroon Up", "aroon-up", {{"
 std::vector<double> AroonUp::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -247,7 +247,7 @@ AroonDown::AroonDown(int period, int offset) : Indicator("Aroon Down", "aroon-do
 std::vector<double> AroonDown::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -306,7 +306,7 @@ CCI::CCI(int period, int offset) : Indicator("Commodity Channel Index", "cci", {
 std::vector<double> CCI::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -319,7 +319,7 @@ std::vector<double> CCI::calculate(const std::vector<Candle> &candles, bool norm
                 return cci_values; // Not enough data
             }
 
-            std::vector<double> typical_prices = get_candles_with_source(candles, "hlc3");
+            std::vector<double> typical_prices = get_candles_with_source(candles, CandleSource::HLC3);
             std::vector<double> sma_values = calculate_simple_moving_average(typical_prices, period);
             std::vector<double> mean_deviation_values = calculate_mean_deviation(typical_prices, sma_values);
 
@@ -390,7 +390,7 @@ DPO::DPO(int period, int offset) : Indicator("Detrended Price Oscillator", "dpo"
 std::vector<double> DPO::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int offset = std::get<int>(this->params.at("offset"));
@@ -433,7 +433,7 @@ std::vector<double> DPO::calculate(const std::vector<Candle> &candles, bool norm
  * @param period Period value. Default is 20.
  * @param offset Offset value. Default is 0.
  */
-EMA::EMA(std::string source, int period, int offset) : Indicator("Exponential Moving Average", "ema", {{"source", source}, {"period", period}, {"offset", offset}}) {}
+EMA::EMA(std::string source, int period, int offset) : Indicator("Exponential Moving Average", "ema", {{"source", source}, {"period", period}, {"offset", offset}}), source(parse_candle_source(source)) {}
 
 /**
  * @brief Calculate the EMA values.
@@ -445,9 +445,8 @@ EMA::EMA(std::string source, int period, int offset) : Indicator("Exponential Mo
 std::vector<double> EMA::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
-            std::string source = std::get<std::string>(this->params.at("source"));
             int period = std::get<int>(this->params.at("period"));
             std::vector<double> ema_values(candles.size(), 0.0); // Initialize ema_values with the same size as input vectors
 
@@ -495,7 +494,7 @@ KST::KST(int roc_periods1, int roc_periods2, int roc_periods3, int roc_periods4,
 std::vector<double> KST::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int roc_periods1 = std::get<int>(this->params.at("roc_periods1"));
             int roc_periods2 = std::get<int>(this->params.at("roc_periods2"));
@@ -558,9 +557,9 @@ MACD::MACD(int short_period, int long_period, int signal_period, int offset) : I
 std::vector<double> MACD::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {   
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> macd_line = calculate_macd_line(closes);
             std::vector<double> signal_line = calculate_signal_line(macd_line);
 
@@ -632,7 +631,7 @@ MI::MI(int offset) : Indicator("Mass Index", "mi", {{"offset", offset}}) {}
 std::vector<double> MI::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             std::vector<double> high_low_diff;
             high_low_diff.reserve(candles.size());
@@ -691,7 +690,7 @@ ParabolicSAR::ParabolicSAR(double acceleration_factor_initial, double accelerati
 std::vector<double> ParabolicSAR::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             std::vector<double> sar_values(candles.size(), 0.0);
 
@@ -775,7 +774,7 @@ std::vector<double> ParabolicSAR::calculate(const std::vector<Candle> &candles,
  * @param period Period for the SMA calculation.
  * @param offset Offset value. Default is 0.
  */
-SMA::SMA(std::string source, int period, int offset) : Indicator("Simple Moving Average", "sma", {{"source", source}, {"period", period}, {"offset", offset}}) {}
+SMA::SMA(std::string source, int period, int offset) : Indicator("Simple Moving Average", "sma", {{"source", source}, {"period", period}, {"offset", offset}}), source(parse_candle_source(source)) {}
 
 /**
  * @brief Calculate the Simple Moving Average (SMA).
@@ -787,9 +786,8 @@ SMA::SMA(std::string source, int period, int offset) : Indicator("Simple Moving
 std::vector<double> SMA::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
-            std::string source = std::get<std::string>(this->params.at("source"));
             int period = std::get<int>(this->params.at("period"));
 
             std::vector<double> values = get_candles_with_source(candles, source);
@@ -893,7 +891,7 @@ std::vector<double> TRIX::calculate(const std::vector<Candle> &candles, bool nor
         {
             int period = std::get<int>(this->params.at("period"));
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> ema1 = calculate_exponential_moving_average(closes, period);
             std::vector<double> ema2 = calculate_exponential_moving_average(ema1, period);
             std::vector<double> ema3 = calculate_exponential_moving_average(ema2, period);
@@ -1012,7 +1010,7 @@ std::vector<double> InstitutionalBias::calculate(const std::vector<Candle> &cand
             int short_period = std::get<int>(this->params.at("short_period"));
             int long_period = std::get<int>(this->params.at("long_period"));
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> short_ema = calculate_exponential_moving_average(closes, short_period);
             std::vector<double> long_ema = calculate_exponential_moving_average(closes, long_period);
 
@@ -1062,7 +1060,7 @@ std::vector<double> EMADifference::calculate(const std::vector<Candle> &candles,
             int short_period = std::get<int>(this->params.at("short_period"));
             int long_period = std::get<int>(this->params.at("long_period"));
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> short_ema = calculate_exponential_moving_average(closes, short_period);
             std::vector<double> long_ema = calculate_exponential_moving_average(closes, long_period);
 
@@ -1098,7 +1096,7 @@ AroonTrend::AroonTrend(int period, int offset) : Indicator("Aroon Trend", "aroon
 std::vector<double> AroonTrend::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             std::vector<double> aroon_trend_values(candles.size(), 0.0); // Initialize aroon_trend_values with the same size as input vectors
@@ -1373,7 +1371,7 @@ std::vector<double> IchimokuKijunTenkanTrend::calculate(const std::vector<Candle
  * @param offset Offset value. Default is 0.
  */
 SMASlope::SMASlope(int period, std::string source, int offset)
-    : Indicator("Simple Moving Average Slope", "sma-slope", {{"period", period}, {"source", source}, {"offset", offset}}) {}
+    : Indicator("Simple Moving Average Slope", "sma-slope", {{"period", period}, {"source", source}, {"offset", offset}}), source(parse_candle_source(source)) {}
 
 /**
  * @brief Calculate the slope of the simple moving average.
@@ -1388,7 +1386,6 @@ std::vector<double> SMASlope::calculate(const std::vector<Candle> &candles, bool
         candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
-            std::string source = std::get<std::string>(this->params.at("source"));
 
             // Calculate the moving average
             std::vector<double> sma_values = calculate_simple_moving_average(get_candles_with_source(candles, source), period);
@@ -1417,7 +1414,7 @@ std::vector<double> SMASlope::calculate(const std::vector<Candle> &candles, bool
  * @param offset Offset value. Default is 0.
  */
 EMASlope::EMASlope(int period, std::string source, int offset)
-    : Indicator("Exponential Moving Average Slope", "ema-slope", {{"period", period}, {"source", source}, {"offset", offset}}) {}
+    : Indicator("Exponential Moving Average Slope", "ema-slope", {{"period", period}, {"source", source}, {"offset", offset}}), source(parse_candle_source(source)) {}
 
 /**
  * @brief Calculate the slope of the exponential moving average.
@@ -1432,7 +1429,6 @@ std::vector<double> EMASlope::calculate(const std::vector<Candle> &candles, bool
         candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
-            std::string source = std::get<std::string>(this->params.at("source"));
 
             // Calculate the moving average
             std::vector<double> sma_values = calculate_exponential_moving_average(get_candles_with_source(candles, source), period);
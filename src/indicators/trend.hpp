@@ -226,6 +226,9 @@ public:
      * @return std::vector<double> Vector containing calculated values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    CandleSource source; // Candle source, decoded at construction
 };
 
 // *********************************************************************************************
@@ -396,6 +399,9 @@ public:
      * @return std::vector<double> Vector containing the calculated SMA values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    CandleSource source; // Candle source, decoded at construction
 };
 
 // *********************************************************************************************
@@ -654,6 +660,9 @@ public:
      * @return std::vector<double> Vector containing calculated slope values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    CandleSource source; // Candle source, decoded at construction
 };
 
 // *********************************************************************************************
@@ -683,6 +692,9 @@ public:
      * @return std::vector<double> Vector containing calculated slope values.
      */
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
+
+private:
+    CandleSource source; // Candle source, decoded at construction
 };
 
 // *********************************************************************************************
@@ -713,7 +725,7 @@ public:
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> trend_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> trend_indicators_map = {
     {"adx", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
@@ -24,7 +24,7 @@ ADXSignal::ADXSignal(int period, int threshold, int offset) : Indicator("Average
 std::vector<double> ADXSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int threshold = std::get<int>(this->params.at("threshold"));
@@ -65,7 +65,7 @@ AroonSignal::AroonSignal(int period, int offset) : Indicator("Aroon (Signal)", "
 std::vector<double> AroonSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int offset = std::get<int>(this->params.at("offset"));
@@ -112,7 +112,7 @@ CCISignal::CCISignal(int period, int overbought, int oversold, int offset) : Ind
 std::vector<double> CCISignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int overbought = std::get<int>(this->params.at("overbought"));
@@ -158,7 +158,7 @@ DPOSignal::DPOSignal(int period, int offset) : Indicator("Detrended Price Oscill
 std::vector<double> DPOSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int offset = std::get<int>(this->params.at("offset"));
@@ -203,7 +203,7 @@ EMASignal::EMASignal(std::string source, int period, int offset) : Indicator("Ex
 std::vector<double> EMASignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             std::string source = std::get<std::string>(this->params.at("source"));
             int period = std::get<int>(this->params.at("period"));
@@ -255,7 +255,7 @@ KSTSignal::KSTSignal(int roc_period1, int roc_period2, int roc_period3, int roc_
 std::vector<double> KSTSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int roc_period1 = std::get<int>(this->params.at("roc_period1"));
             int roc_period2 = std::get<int>(this->params.at("roc_period2"));
@@ -309,7 +309,7 @@ MACDSignal::MACDSignal(int short_period, int long_period, int signal_period, int
 std::vector<double> MACDSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int short_period = std::get<int>(this->params.at("short_period"));
             int long_period = std::get<int>(this->params.at("long_period"));
@@ -317,7 +317,7 @@ std::vector<double> MACDSignal::calculate(const std::vector<Candle> &candles, bo
             int offset = std::get<int>(this->params.at("offset"));
 
             std::vector<double> result(candles.size(), 0.0);
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
 
             // Calculate short and long EMA
             std::vector<double> short_ema = calculate_exponential_moving_average(closes, short_period);
@@ -371,7 +371,7 @@ ParabolicSARSignal::ParabolicSARSignal(double acceleration_factor_initial, doubl
 std::vector<double> ParabolicSARSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             double acceleration_factor_initial = std::get<double>(this->params.at("acceleration_factor_initial"));
             double acceleration_factor_maximum = std::get<double>(this->params.at("acceleration_factor_maximum"));
@@ -417,7 +417,7 @@ SMASignal::SMASignal(std::string source, int period, int offset) : Indicator("Si
 std::vector<double> SMASignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             std::string source = std::get<std::string>(this->params.at("source"));
             int period = std::get<int>(this->params.at("period"));
@@ -462,7 +462,7 @@ TRIXSignal::TRIXSignal(int period, int offset) : Indicator("Triple Exponential A
 std::vector<double> TRIXSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int offset = std::get<int>(this->params.at("offset"));
@@ -507,7 +507,7 @@ VortexSignal::VortexSignal(int period, int offset) : Indicator("Vortex (Signal)"
 std::vector<double> VortexSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int offset = std::get<int>(this->params.at("offset"));
@@ -590,7 +590,7 @@ InstitutionalBiasSignal::InstitutionalBiasSignal(int short_period, int long_peri
 std::vector<double> InstitutionalBiasSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int short_period = std::get<int>(this->params.at("short_period"));
             int long_period = std::get<int>(this->params.at("long_period"));
@@ -639,7 +639,7 @@ IchimokuCloudSignal::IchimokuCloudSignal(int conversion_period, int base_period,
 std::vector<double> IchimokuCloudSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int conversion_period = std::get<int>(this->params.at("conversion_period"));
             int base_period = std::get<int>(this->params.at("base_period"));
@@ -751,7 +751,7 @@ IchimokuKijunTenkanSignal::IchimokuKijunTenkanSignal(int conversion_period, int
 std::vector<double> IchimokuKijunTenkanSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int conversion_period = std::get<int>(this->params.at("conversion_period"));
             int base_period = std::get<int>(this->params.at("base_period"));
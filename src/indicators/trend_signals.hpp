@@ -356,7 +356,7 @@ public:
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> trend_signals_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> trend_signals_indicators_map = {
     {"adx-signal", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
@@ -1,5 +1,9 @@
 #include <vector>
 #include <cmath>
+#include <algorithm>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 #include "utils.hpp"
 
 /**
@@ -12,10 +16,25 @@
 std::vector<double> calculate_simple_moving_average(const std::vector<double> &values, int period)
 {
     std::vector<double> sma(values.size(), 0.0); // Initialize sma vector with the same size as values
+    calculate_simple_moving_average(values.data(), values.size(), period, sma.data());
+    return sma;
+}
 
-    if (period > values.size())
+/**
+ * @brief Calculate the simple moving average (SMA) into a caller-owned buffer.
+ *
+ * @param values The input values.
+ * @param count The number of values to process.
+ * @param period Period or number of values to consider for the SMA calculation.
+ * @param output The buffer receiving the simple moving average values.
+ */
+void calculate_simple_moving_average(const double *values, size_t count, int period, double *output)
+{
+    std::fill(output, output + count, 0.0);
+
+    if (static_cast<size_t>(period) > count)
     {
-        return sma;
+        return;
     }
 
     // Calculate the initial SMA as the average of the first period values
@@ -25,16 +44,14 @@ std::vector<double> calculate_simple_moving_average(const std::vector<double> &v
         sum += values[i];
     }
 
-    sma[period - 1] = sum / period;
+    output[period - 1] = sum / period;
 
     // Calculate SMA for subsequent periods
-    for (size_t i = period; i < values.size(); ++i)
+    for (size_t i = period; i < count; ++i)
     {
         sum += values[i] - values[i - period]; // Update sum by removing the oldest value and adding the newest
-        sma[i] = sum / period;                 // Calculate and store the SMA
+        output[i] = sum / period;              // Calculate and store the SMA
     }
-
-    return sma;
 }
 
 /**
@@ -47,9 +64,125 @@ std::vector<double> calculate_simple_moving_average(const std::vector<double> &v
 std::vector<double> calculate_exponential_moving_average(const std::vector<double> &values, int period)
 {
     std::vector<double> ema(values.size(), 0.0); // Initialize ema with zeros and same size as data
+    calculate_exponential_moving_average(values.data(), values.size(), period, ema.data());
+    return ema;
+}
+
+/**
+ * @brief Calculate the exponential moving average (EMA) into a caller-owned buffer.
+ *
+ * @param values The input values.
+ * @param count The number of values to process.
+ * @param period Period or number of values to consider for the EMA calculation.
+ * @param output The buffer receiving the exponential moving average values.
+ */
+void calculate_exponential_moving_average(const double *values, size_t count, int period, double *output)
+{
+    std::fill(output, output + count, 0.0);
+
     double multiplier = 2.0 / (1 + period);
     double ema_prev = 0;
 
+    if (static_cast<size_t>(period) > count)
+    {
+        return;
+    }
+
+    // Calculate SMA for the first n days
+    for (int i = 0; i < period; ++i)
+    {
+        ema_prev += values[i];
+    }
+    ema_prev /= period;
+
+    // Set the first EMA value
+    output[period - 1] = ema_prev;
+
+    // Calculate EMA for the rest of the data
+    size_t i = period;
+#if defined(__AVX2__)
+    // Unroll the recurrence algebraically over blocks of 4 values:
+    // ema[i+k] = (1-a)^(k+1) * ema[i-1] + sum of a*(1-a)^(k-j) * values[i+j].
+    // The weighted prefix sums are built with two shifted multiply-adds, so the
+    // serial dependence is carried once per block instead of once per value.
+    double beta = 1 - multiplier;
+    const __m256d alpha_v = _mm256_set1_pd(multiplier);
+    const __m256d beta_1 = _mm256_set1_pd(beta);
+    const __m256d beta_2 = _mm256_set1_pd(beta * beta);
+    const __m256d decay = _mm256_set_pd(beta * beta * beta * beta, beta * beta * beta, beta * beta, beta);
+    const __m256d zero = _mm256_setzero_pd();
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256d block = _mm256_mul_pd(alpha_v, _mm256_loadu_pd(&values[i]));
+
+        // Weighted prefix sums within the block, shifting by one then two lanes
+        __m256d shift_1 = _mm256_blend_pd(_mm256_permute4x64_pd(block, _MM_SHUFFLE(2, 1, 0, 0)), zero, 0x1);
+        block = _mm256_add_pd(block, _mm256_mul_pd(beta_1, shift_1));
+        __m256d shift_2 = _mm256_blend_pd(_mm256_permute4x64_pd(block, _MM_SHUFFLE(1, 0, 0, 0)), zero, 0x3);
+        block = _mm256_add_pd(block, _mm256_mul_pd(beta_2, shift_2));
+
+        // Carry the previous EMA into the block through the decay powers
+        block = _mm256_add_pd(block, _mm256_mul_pd(_mm256_set1_pd(ema_prev), decay));
+        _mm256_storeu_pd(&output[i], block);
+        ema_prev = output[i + 3];
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        double ema_today = values[i] * multiplier + ema_prev * (1 - multiplier);
+        output[i] = ema_today;
+        ema_prev = ema_today;
+    }
+}
+
+/**
+ * @brief Calculate the simple moving average (SMA) of a given vector of float32 values.
+ *
+ * @param values Vector of values.
+ * @param period Period or number of values to consider for the SMA calculation.
+ * @return std::vector<float> Vector containing the simple moving average values.
+ */
+std::vector<float> calculate_simple_moving_average(const std::vector<float> &values, int period)
+{
+    std::vector<float> sma(values.size(), 0.0f); // Initialize sma vector with the same size as values
+
+    if (period > values.size())
+    {
+        return sma;
+    }
+
+    // Calculate the initial SMA as the average of the first period values
+    float sum = 0.0f;
+    for (int i = 0; i < period; ++i)
+    {
+        sum += values[i];
+    }
+
+    sma[period - 1] = sum / period;
+
+    // Calculate SMA for subsequent periods
+    for (size_t i = period; i < values.size(); ++i)
+    {
+        sum += values[i] - values[i - period]; // Update sum by removing the oldest value and adding the newest
+        sma[i] = sum / period;                 // Calculate and store the SMA
+    }
+
+    return sma;
+}
+
+/**
+ * @brief Calculate the exponential moving average (EMA) of a given vector of float32 values.
+ *
+ * @param values Vector of values.
+ * @param period Period or number of values to consider for the EMA calculation.
+ * @return std::vector<float> Vector containing the exponential moving average values.
+ */
+std::vector<float> calculate_exponential_moving_average(const std::vector<float> &values, int period)
+{
+    std::vector<float> ema(values.size(), 0.0f); // Initialize ema with zeros and same size as data
+    float multiplier = 2.0f / (1 + period);
+    float ema_prev = 0;
+
     if (period > values.size())
     {
         return ema;
@@ -66,9 +199,48 @@ std::vector<double> calculate_exponential_moving_average(const std::vector<doubl
     ema[period - 1] = ema_prev;
 
     // Calculate EMA for the rest of the data
-    for (size_t i = period; i < values.size(); ++i)
+    size_t i = period;
+#if defined(__AVX2__)
+    // Same algebraic unrolling as the double version, but 8 lanes wide: the
+    // weighted prefix sums are built with three shifted multiply-adds and the
+    // serial dependence is carried once per block of 8 values.
+    float beta = 1 - multiplier;
+    float beta_pow[9];
+    beta_pow[0] = 1.0f;
+    for (int k = 1; k <= 8; ++k)
     {
-        double ema_today = values[i] * multiplier + ema_prev * (1 - multiplier);
+        beta_pow[k] = beta_pow[k - 1] * beta;
+    }
+    const __m256 alpha_v = _mm256_set1_ps(multiplier);
+    const __m256 beta_1 = _mm256_set1_ps(beta);
+    const __m256 beta_2 = _mm256_set1_ps(beta_pow[2]);
+    const __m256 beta_4 = _mm256_set1_ps(beta_pow[4]);
+    const __m256 decay = _mm256_set_ps(beta_pow[8], beta_pow[7], beta_pow[6], beta_pow[5], beta_pow[4], beta_pow[3], beta_pow[2], beta_pow[1]);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256i shift_1_idx = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+    const __m256i shift_2_idx = _mm256_setr_epi32(0, 0, 0, 1, 2, 3, 4, 5);
+    const __m256i shift_4_idx = _mm256_setr_epi32(0, 0, 0, 0, 0, 1, 2, 3);
+    for (; i + 8 <= values.size(); i += 8)
+    {
+        __m256 block = _mm256_mul_ps(alpha_v, _mm256_loadu_ps(&values[i]));
+
+        // Weighted prefix sums within the block, shifting by one, two then four lanes
+        __m256 shift_1 = _mm256_blend_ps(_mm256_permutevar8x32_ps(block, shift_1_idx), zero, 0x01);
+        block = _mm256_add_ps(block, _mm256_mul_ps(beta_1, shift_1));
+        __m256 shift_2 = _mm256_blend_ps(_mm256_permutevar8x32_ps(block, shift_2_idx), zero, 0x03);
+        block = _mm256_add_ps(block, _mm256_mul_ps(beta_2, shift_2));
+        __m256 shift_4 = _mm256_blend_ps(_mm256_permutevar8x32_ps(block, shift_4_idx), zero, 0x0F);
+        block = _mm256_add_ps(block, _mm256_mul_ps(beta_4, shift_4));
+
+        // Carry the previous EMA into the block through the decay powers
+        block = _mm256_add_ps(block, _mm256_mul_ps(_mm256_set1_ps(ema_prev), decay));
+        _mm256_storeu_ps(&ema[i], block);
+        ema_prev = ema[i + 7];
+    }
+#endif
+    for (; i < values.size(); ++i)
+    {
+        float ema_today = values[i] * multiplier + ema_prev * (1 - multiplier);
         ema[i] = ema_today;
         ema_prev = ema_today;
     }
@@ -76,6 +248,102 @@ std::vector<double> calculate_exponential_moving_average(const std::vector<doubl
     return ema;
 }
 
+/**
+ * @brief Calculate the rolling maximum of a given vector of values.
+ *
+ * @param values Vector of values.
+ * @param period Number of values covered by each window, current value included.
+ * @return std::vector<double> Vector containing the rolling maximum values.
+ */
+std::vector<double> calculate_rolling_max(const std::vector<double> &values, int period)
+{
+    size_t size = values.size();
+    std::vector<double> result(size, 0.0);
+
+    if (size == 0 || period <= 0)
+    {
+        return result;
+    }
+
+    size_t window = static_cast<size_t>(period);
+
+    // Running maximum from the start of each block of window values
+    std::vector<double> prefix_max(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        prefix_max[i] = (i % window == 0) ? values[i] : std::max(prefix_max[i - 1], values[i]);
+    }
+
+    // Running maximum towards the end of each block of window values
+    std::vector<double> suffix_max(size);
+    for (size_t block_start = 0; block_start < size; block_start += window)
+    {
+        size_t block_end = std::min(block_start + window, size);
+        suffix_max[block_end - 1] = values[block_end - 1];
+        for (size_t i = block_end - 1; i-- > block_start;)
+        {
+            suffix_max[i] = std::max(suffix_max[i + 1], values[i]);
+        }
+    }
+
+    // Each window spans at most two blocks, so its maximum is the suffix of the
+    // first block combined with the prefix of the second one
+    for (size_t i = 0; i < size; ++i)
+    {
+        result[i] = (i + 1 < window) ? prefix_max[i] : std::max(suffix_max[i + 1 - window], prefix_max[i]);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calculate the rolling minimum of a given vector of values.
+ *
+ * @param values Vector of values.
+ * @param period Number of values covered by each window, current value included.
+ * @return std::vector<double> Vector containing the rolling minimum values.
+ */
+std::vector<double> calculate_rolling_min(const std::vector<double> &values, int period)
+{
+    size_t size = values.size();
+    std::vector<double> result(size, 0.0);
+
+    if (size == 0 || period <= 0)
+    {
+        return result;
+    }
+
+    size_t window = static_cast<size_t>(period);
+
+    // Running minimum from the start of each block of window values
+    std::vector<double> prefix_min(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        prefix_min[i] = (i % window == 0) ? values[i] : std::min(prefix_min[i - 1], values[i]);
+    }
+
+    // Running minimum towards the end of each block of window values
+    std::vector<double> suffix_min(size);
+    for (size_t block_start = 0; block_start < size; block_start += window)
+    {
+        size_t block_end = std::min(block_start + window, size);
+        suffix_min[block_end - 1] = values[block_end - 1];
+        for (size_t i = block_end - 1; i-- > block_start;)
+        {
+            suffix_min[i] = std::min(suffix_min[i + 1], values[i]);
+        }
+    }
+
+    // Each window spans at most two blocks, so its minimum is the suffix of the
+    // first block combined with the prefix of the second one
+    for (size_t i = 0; i < size; ++i)
+    {
+        result[i] = (i + 1 < window) ? prefix_min[i] : std::min(suffix_min[i + 1 - window], prefix_min[i]);
+    }
+
+    return result;
+}
+
 /**
  * @brief Calculate the standard deviation of a given vector of values.
  *
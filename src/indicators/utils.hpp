@@ -1,6 +1,7 @@
 #ifndef UTILS_INDICATORS_HPP
 #define UTILS_INDICATORS_HPP
 
+#include <cstddef>
 #include <vector>
 
 /**
@@ -12,6 +13,20 @@
  */
 std::vector<double> calculate_simple_moving_average(const std::vector<double> &values, int period);
 
+/**
+ * @brief Calculate the simple moving average (SMA) into a caller-owned buffer.
+ *
+ * Allocation-free overload for the batch paths, so the moving averages can be
+ * computed into reused scratch buffers. The output buffer must hold count
+ * values and must not alias the input.
+ *
+ * @param values The input values.
+ * @param count The number of values to process.
+ * @param period Period or number of values to consider for the SMA calculation.
+ * @param output The buffer receiving the simple moving average values.
+ */
+void calculate_simple_moving_average(const double *values, size_t count, int period, double *output);
+
 /**
  * @brief Calculate the exponential moving average (EMA) of a given vector of values.
  *
@@ -21,6 +36,70 @@ std::vector<double> calculate_simple_moving_average(const std::vector<double> &v
  */
 std::vector<double> calculate_exponential_moving_average(const std::vector<double> &values, int periods);
 
+/**
+ * @brief Calculate the exponential moving average (EMA) into a caller-owned buffer.
+ *
+ * Allocation-free overload for the batch paths, so the moving averages can be
+ * computed into reused scratch buffers. The output buffer must hold count
+ * values and must not alias the input.
+ *
+ * @param values The input values.
+ * @param count The number of values to process.
+ * @param period Period or number of values to consider for the EMA calculation.
+ * @param output The buffer receiving the exponential moving average values.
+ */
+void calculate_exponential_moving_average(const double *values, size_t count, int period, double *output);
+
+/**
+ * @brief Calculate the simple moving average (SMA) of a given vector of float32 values.
+ *
+ * Float32 overload for scale-invariant indicators: the narrower width doubles
+ * the cache-resident history and the SIMD lane count.
+ *
+ * @param values Vector of values.
+ * @param period Period or number of values to consider for the SMA calculation.
+ * @return std::vector<float> Vector containing the simple moving average values.
+ */
+std::vector<float> calculate_simple_moving_average(const std::vector<float> &values, int period);
+
+/**
+ * @brief Calculate the exponential moving average (EMA) of a given vector of float32 values.
+ *
+ * Float32 overload for scale-invariant indicators: the narrower width doubles
+ * the cache-resident history and the SIMD lane count.
+ *
+ * @param values Vector of values.
+ * @param period Period or number of values to consider for the EMA calculation.
+ * @return std::vector<float> Vector containing the exponential moving average values.
+ */
+std::vector<float> calculate_exponential_moving_average(const std::vector<float> &values, int period);
+
+/**
+ * @brief Calculate the rolling maximum of a given vector of values.
+ *
+ * Uses the batched prefix/suffix algorithm so the cost stays O(N) whatever the
+ * period, instead of rescanning the whole window for every value. The windows
+ * at the start of the vector are partial and cover the values seen so far.
+ *
+ * @param values Vector of values.
+ * @param period Number of values covered by each window, current value included.
+ * @return std::vector<double> Vector containing the rolling maximum values.
+ */
+std::vector<double> calculate_rolling_max(const std::vector<double> &values, int period);
+
+/**
+ * @brief Calculate the rolling minimum of a given vector of values.
+ *
+ * Uses the batched prefix/suffix algorithm so the cost stays O(N) whatever the
+ * period, instead of rescanning the whole window for every value. The windows
+ * at the start of the vector are partial and cover the values seen so far.
+ *
+ * @param values Vector of values.
+ * @param period Number of values covered by each window, current value included.
+ * @return std::vector<double> Vector containing the rolling minimum values.
+ */
+std::vector<double> calculate_rolling_min(const std::vector<double> &values, int period);
+
 /**
  * @brief Calculate the standard deviation of a given vector of values.
  *
@@ -1,4 +1,5 @@
 #include <numeric>
+#include <cmath>
 #include <algorithm>
 #include "../types.hpp"
 #include "../utils/candles_source.hpp"
@@ -24,7 +25,7 @@ ATR::ATR(int period, int offset) : Indicator("Average True Range", "atr", {{"per
 std::vector<double> ATR::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             std::vector<double> atr_values(candles.size(), 0.0);
@@ -103,7 +104,7 @@ BollingerChannelHighBand::BollingerChannelHighBand(int period, double multiplier
 std::vector<double> BollingerChannelHighBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             double multiplier = std::get<double>(this->params.at("multiplier"));
@@ -114,7 +115,7 @@ std::vector<double> BollingerChannelHighBand::calculate(const std::vector<Candle
                 return bollinger_channel_high_band_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> sma_values = calculate_simple_moving_average(closes, period);
             std::vector<double> std_dev_values = calculate_standard_deviation(closes, period);
 
@@ -149,7 +150,7 @@ BollingerChannelLowBand::BollingerChannelLowBand(int period, double multiplier,
 std::vector<double> BollingerChannelLowBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             double multiplier = std::get<double>(this->params.at("multiplier"));
@@ -160,7 +161,7 @@ std::vector<double> BollingerChannelLowBand::calculate(const std::vector<Candle>
                 return bollinger_channel_low_band_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> sma_values = calculate_simple_moving_average(closes, period);
             std::vector<double> std_dev_values = calculate_standard_deviation(closes, period);
 
@@ -194,7 +195,7 @@ BollingerChannelMiddleBand::BollingerChannelMiddleBand(int period, int offset) :
 std::vector<double> BollingerChannelMiddleBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -204,7 +205,7 @@ std::vector<double> BollingerChannelMiddleBand::calculate(const std::vector<Cand
                 return bollinger_channel_middle_band_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> sma_values = calculate_simple_moving_average(closes, period);
 
             for (size_t i = 0; i < candles.size(); ++i)
@@ -238,7 +239,7 @@ BollingerChannelPercentageBand::BollingerChannelPercentageBand(int period, doubl
 std::vector<double> BollingerChannelPercentageBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             double multiplier = std::get<double>(this->params.at("multiplier"));
@@ -249,7 +250,7 @@ std::vector<double> BollingerChannelPercentageBand::calculate(const std::vector<
                 return bollinger_channel_percentage_band_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> sma_values = calculate_simple_moving_average(closes, period);
             std::vector<double> std_dev_values = calculate_standard_deviation(closes, period);
 
@@ -288,7 +289,7 @@ BollingerChannelWidthBand::BollingerChannelWidthBand(int period, double multipli
 std::vector<double> BollingerChannelWidthBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             double multiplier = std::get<double>(this->params.at("multiplier"));
@@ -299,7 +300,7 @@ std::vector<double> BollingerChannelWidthBand::calculate(const std::vector<Candl
                 return bollinger_channel_width_band_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> sma_values = calculate_simple_moving_average(closes, period);
             std::vector<double> std_dev_values = calculate_standard_deviation(closes, period);
 
@@ -337,7 +338,7 @@ DonchianChannelHighBand::DonchianChannelHighBand(int period, int offset) : Indic
 std::vector<double> DonchianChannelHighBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -386,7 +387,7 @@ DonchianChannelLowBand::DonchianChannelLowBand(int period, int offset) : Indicat
 std::vector<double> DonchianChannelLowBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -435,7 +436,7 @@ DonchianChannelMiddleBand::DonchianChannelMiddleBand(int period, int offset) : I
 std::vector<double> DonchianChannelMiddleBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -488,7 +489,7 @@ KeltnerChannelHighBand::KeltnerChannelHighBand(int period, int atr_period, doubl
 std::vector<double> KeltnerChannelHighBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             int atr_period = std::get<int>(this->params.at("atr_period"));
@@ -500,7 +501,7 @@ std::vector<double> KeltnerChannelHighBand::calculate(const std::vector<Candle>
                 return keltner_channel_high_band_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> ema_values = calculate_exponential_moving_average(closes, period);
             std::vector<double> atr_values = ATR(atr_period).calculate(candles);
 
@@ -536,7 +537,7 @@ KeltnerChannelLowBand::KeltnerChannelLowBand(int period, int atr_period, double
 std::vector<double> KeltnerChannelLowBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             int atr_period = std::get<int>(this->params.at("atr_period"));
@@ -548,7 +549,7 @@ std::vector<double> KeltnerChannelLowBand::calculate(const std::vector<Candle> &
                 return keltner_channel_low_band_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> ema_values = calculate_exponential_moving_average(closes, period);
             std::vector<double> atr_values = ATR(atr_period).calculate(candles);
 
@@ -582,7 +583,7 @@ KeltnerChannelMiddleBand::KeltnerChannelMiddleBand(int period, int offset) : Ind
 std::vector<double> KeltnerChannelMiddleBand::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -592,7 +593,7 @@ std::vector<double> KeltnerChannelMiddleBand::calculate(const std::vector<Candle
                 return keltner_channel_middle_band_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> ema_values = calculate_exponential_moving_average(closes, period);
 
             for (size_t i = period - 1; i < candles.size(); ++i)
@@ -625,7 +626,7 @@ UI::UI(int period, int offset) : Indicator("Ulcer Index", "ui", {{"period", peri
 std::vector<double> UI::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -635,7 +636,7 @@ std::vector<double> UI::calculate(const std::vector<Candle> &candles, bool norma
                 return ui_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             std::vector<double> max_values(candles.size(), 0.0);
 
             for (size_t i = period - 1; i < candles.size(); ++i)
@@ -691,7 +692,7 @@ StandardDeviation::StandardDeviation(int period, int offset) : Indicator("Standa
 std::vector<double> StandardDeviation::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
 
@@ -701,7 +702,7 @@ std::vector<double> StandardDeviation::calculate(const std::vector<Candle> &cand
                 return stddev_values;
             }
 
-            std::vector<double> closes = get_candles_with_source(candles, "close");
+            std::vector<double> closes = get_candles_with_source(candles, CandleSource::CLOSE);
             stddev_values = calculate_standard_deviation(closes, period);
 
             return stddev_values; },
@@ -729,7 +730,7 @@ AveragePriceChange::AveragePriceChange(int period, int offset) : Indicator("Aver
 std::vector<double> AveragePriceChange::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles) -> std::vector<double>
+        candles, [this](const std::vector<Candle> &candles) -> std::vector<double>
         {
             int period = std::get<int>(this->params.at("period"));
             
@@ -390,7 +390,7 @@ public:
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> volatility_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> volatility_indicators_map = {
     {"atr", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
@@ -22,7 +22,7 @@ ATRSignal::ATRSignal(int period, double threshold, int offset) : Indicator("Aver
 std::vector<double> ATRSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             double threshold = std::get<double>(this->params.at("threshold"));
@@ -64,7 +64,7 @@ BollingerChannelSignal::BollingerChannelSignal(int period, double multiplier, in
 std::vector<double> BollingerChannelSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             double multiplier = std::get<double>(this->params.at("multiplier"));
@@ -119,7 +119,7 @@ DonchianChannelSignal::DonchianChannelSignal(int period, int offset) : Indicator
 std::vector<double> DonchianChannelSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int offset = std::get<int>(this->params.at("offset"));
@@ -175,7 +175,7 @@ KeltnerChannelSignal::KeltnerChannelSignal(int period, int atr_period, double mu
 std::vector<double> KeltnerChannelSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             int atr_period = std::get<int>(this->params.at("atr_period"));
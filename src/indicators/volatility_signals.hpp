@@ -105,7 +105,7 @@ public:
 
 // *********************************************************************************************
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> volatility_signals_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> volatility_signals_indicators_map = {
     {"atr-signal", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
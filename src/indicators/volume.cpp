@@ -22,7 +22,7 @@ ADL::ADL(int offset) : Indicator("Accumulation/Distribution Line", "adl", {{"off
 std::vector<double> ADL::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             std::vector<double> adi_values(candles.size(), 0);
             double previous_adi = 0.0;
@@ -413,7 +413,7 @@ std::vector<double> VWAP::calculate(const std::vector<Candle> &candles, bool nor
             double cumulative_price_volume = 0.0;
             double cumulative_volume = 0.0;
 
-            std::vector<double> typical_prices = get_candles_with_source(candles, "hlc3");
+            std::vector<double> typical_prices = get_candles_with_source(candles, CandleSource::HLC3);
 
             for (size_t i = 0; i < candles.size(); ++i)
             {
@@ -254,7 +254,7 @@ public:
     std::vector<double> calculate(const std::vector<Candle> &candles, bool normalize_data = false) const override;
 };
 
-const std::unordered_map<std::string, std::function<Indicator *(std::unordered_map<std::string, IndicatorParam>)>> volume_indicators_map = {
+const std::unordered_map<std::string, IndicatorFactory> volume_indicators_map = {
     {"adl", [](std::unordered_map<std::string, IndicatorParam> params) -> Indicator *
      {
          try
@@ -24,7 +24,7 @@ CMFSignal::CMFSignal(int period, double bullish_threshold, double bearish_thresh
 std::vector<double> CMFSignal::calculate(const std::vector<Candle> &candles, bool normalize_data) const
 {
     return Indicator::calculate(
-        candles, [this](std::vector<Candle> candles)
+        candles, [this](const std::vector<Candle> &candles)
         {
             int period = std::get<int>(this->params.at("period"));
             double bullish_threshold = std::get<double>(this->params.at("bullish_threshold"));
@@ -20,55 +20,55 @@ namespace neat
     {
         // ======== NEAT =========== //
         // The number of individuals in each generation.
-        int population_size;
+        int population_size = 0;
         // When the fitness computed by fitness_criterion meets or exceeds this threshold, the evolution process will terminate
-        double fitness_threshold;
-        bool no_fitness_termination;
+        double fitness_threshold = 0.0;
+        bool no_fitness_termination = false;
         // If this evaluates to True, when all species simultaneously become extinct due to stagnation, a new random population will be created.
-        bool reset_on_extinction;
+        bool reset_on_extinction = false;
 
         // ======== GENOME =========== //
         ActivationFunction activation_default;
-        double activation_mutate_rate;
-        int num_inputs;
-        int num_outputs;
-        int num_hidden_layers;
-        double compatibility_disjoint_coefficient;
-        double compatibility_weight_coefficient;
-        double conn_add_prob;
-        double conn_delete_prob;
-        bool enabled_default;
-        double enabled_mutate_rate;
+        double activation_mutate_rate = 0.0;
+        int num_inputs = 0;
+        int num_outputs = 0;
+        int num_hidden_layers = 0;
+        double compatibility_disjoint_coefficient = 0.0;
+        double compatibility_weight_coefficient = 0.0;
+        double conn_add_prob = 0.0;
+        double conn_delete_prob = 0.0;
+        bool enabled_default = false;
+        double enabled_mutate_rate = 0.0;
         InitialConnection initial_connections;
-        double node_add_prob;
-        double node_delete_prob;
-        double weight_init_mean;
-        double weight_init_stdev;
+        double node_add_prob = 0.0;
+        double node_delete_prob = 0.0;
+        double weight_init_mean = 0.0;
+        double weight_init_stdev = 0.0;
         DistributionType weight_init_type;
-        double weight_max_value;
-        double weight_min_value;
-        double weight_mutate_rate;
-        double weight_replace_rate;
+        double weight_max_value = 0.0;
+        double weight_min_value = 0.0;
+        double weight_mutate_rate = 0.0;
+        double weight_replace_rate = 0.0;
 
         // ======== STAGNATION =========== //
         // Species that have not shown improvement in more than this number of generations will be considered stagnant and removed.
-        int max_stagnation;
+        int max_stagnation = 0;
         // The number of species that will be protected from stagnation; mainly intended to prevent total extinctions caused by all species becoming stagnant before new species arise. For example, a species_elitism setting of 3 will prevent the 3 species with the highest species fitness from being removed for stagnation regardless of the amount of time they have not shown improvement.
-        int species_elitism;
+        int species_elitism = 0;
 
         // ======== REPRODUCTION =========== //
         // The number of most-fit individuals in each species that will be preserved as-is from one generation to the next.
-        int elitism;
+        int elitism = 0;
         // The fraction for each species allowed to reproduce each generation.
-        double survival_threshold;
+        double survival_threshold = 0.0;
         // The minimum number of genomes per species after reproduction.
-        int min_species_size;
+        int min_species_size = 0;
 
         // ======== SPECIES =========== //
         // Individuals whose genomic distance is less than this threshold are considered to be in the same species.
-        double compatibility_threshold;
+        double compatibility_threshold = 0.0;
         // If average fitness of the specie if below the average fitness fitness of all species
-        double bad_species_threshold;
+        double bad_species_threshold = 0.0;
     };
 
     /**
@@ -2,6 +2,7 @@
 #define NEAT_NODE_HPP
 
 #include <vector>
+#include <memory>
 #include "activation_functions.hpp"
 #include "config.hpp"
 
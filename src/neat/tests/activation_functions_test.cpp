@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <cmath>
 #include "../activation_functions.hpp"
 
 TEST(TestActivationFunctions, Step)
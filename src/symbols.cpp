@@ -1,9 +1,10 @@
 #include <string>
 #include <unordered_map>
+#include "utils/string_arena.hpp"
 #include "types.hpp"
 
 /**
  * @brief Mapping of symbol names to their corresponding SymbolInfo objects.
  */
 std::unordered_map<std::string, SymbolInfo> symbol_infos = {
-    {"EURUSD", {.asset = "EUR", .base = "USD", .decimal_places = 5, .point_value = 0.0001, .contract_size = 100000, .min_lot_size = 0, .max_lot_size = 0, .lot_size_step = 0.01, .commission_per_lot = 2.6, .commission_base = "EUR"}}};
+    {"EURUSD", {.asset = intern_string("EUR"), .base = intern_string("USD"), .decimal_places = 5, .point_value = 0.0001, .contract_size = 100000, .min_lot_size = 0, .max_lot_size = 0, .lot_size_step = 0.01, .commission_per_lot = 2.6, .commission_base = intern_string("EUR")}}};
@@ -32,18 +32,18 @@ protected:
                 .name = "test",
                 .version = "1.0",
                 .symbol = "EURUSD",
-                .leverage = 100,
                 .initial_balance = 1000,
                 .account_currency = "USD",
+                .leverage = 100,
             },
             .strategy = {
                 .timeframe = TimeFrame::M15,
                 .risk_per_trade = 0.02,
+                .maximum_trades_per_day = 2,
                 .maximum_spread = 8,
                 .minimum_trade_duration = 2,
                 .maximum_trade_duration = 4,
                 .minimum_duration_before_next_trade = 4,
-                .maximum_trades_per_day = 2,
                 .can_open_long_trade = true,
                 .can_open_short_trade = true,
                 .take_profit_stop_loss_config = {
@@ -88,7 +88,6 @@ protected:
                 .maximum_drawdown = 0.1,
                 .minimum_winrate = 0.5,
                 .minimum_profit_factor = 2,
-
             },
             .neat = neat::load_config("src/configs/neat_config.txt"),
         };
@@ -136,12 +135,12 @@ TEST_F(TraderTest, UpdateWithNoPositionAndNoOrders)
 
     // Check if balance and stats are updated correctly
     ASSERT_EQ(trader->balance, 1000.0);
-    ASSERT_EQ(trader->stats.total_profit, 0.0);
-    ASSERT_EQ(trader->stats.total_winning_trades, 0);
-    ASSERT_EQ(trader->stats.total_fees, 0.0);
-    ASSERT_EQ(trader->stats.max_drawdown, 0.0);
-    ASSERT_EQ(trader->balance_history.size(), 1);
-    ASSERT_EQ(trader->trades_history.size(), 0);
+    ASSERT_EQ(trader->cold->stats.total_profit, 0.0);
+    ASSERT_EQ(trader->cold->stats.total_winning_trades, 0);
+    ASSERT_EQ(trader->cold->stats.total_fees, 0.0);
+    ASSERT_EQ(trader->cold->stats.max_drawdown, 0.0);
+    ASSERT_EQ(trader->cold->balance_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history.size(), 0);
 }
 
 TEST_F(TraderTest, UpdateWithPosition)
@@ -155,9 +154,9 @@ TEST_F(TraderTest, UpdateWithPosition)
     // Check if balance and stats are updated correctly
     ASSERT_EQ(trader->balance, 1000.0);
     ASSERT_EQ(trader->duration_in_position, 1);
-    ASSERT_EQ(trader->stats.total_profit, 0);
-    ASSERT_EQ(trader->stats.total_winning_trades, 0);
-    ASSERT_EQ(trader->stats.max_drawdown, 0.0);
+    ASSERT_EQ(trader->cold->stats.total_profit, 0);
+    ASSERT_EQ(trader->cold->stats.total_winning_trades, 0);
+    ASSERT_EQ(trader->cold->stats.max_drawdown, 0.0);
     ASSERT_EQ(trader->nb_trades_today, 0);
 }
 
@@ -195,17 +194,17 @@ TEST_F(TraderTest, UpdateWithOpenOrders)
 {
     // Mock data for testing
     trader->open_orders = {
-        {.type = OrderType::TAKE_PROFIT, .side = OrderSide::SHORT, .price = 105.0}};
+        {.side = OrderSide::SHORT, .type = OrderType::TAKE_PROFIT, .price = 105.0}};
 
     // Call the update method
     trader->update(trader->candles);
 
     // Check if balance and stats are updated correctly
     ASSERT_EQ(trader->balance, 1000.0);
-    ASSERT_EQ(trader->stats.total_profit, 0.0);
-    ASSERT_EQ(trader->stats.total_winning_trades, 0);
-    ASSERT_EQ(trader->stats.max_drawdown, 0.0);
-    ASSERT_EQ(trader->balance_history.size(), 1);
+    ASSERT_EQ(trader->cold->stats.total_profit, 0.0);
+    ASSERT_EQ(trader->cold->stats.total_winning_trades, 0);
+    ASSERT_EQ(trader->cold->stats.max_drawdown, 0.0);
+    ASSERT_EQ(trader->cold->balance_history.size(), 1);
 }
 
 TEST_F(TraderTest, UpdateWithPositionLiquidation)
@@ -223,21 +222,21 @@ TEST_F(TraderTest, UpdateWithPositionLiquidation)
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->open_orders.size(), 0);
     ASSERT_EQ(trader->balance, 0.0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, date);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::LONG);
-    ASSERT_LT(trader->trades_history[0].pnl, 0.0);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 0.01);
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::LONG);
+    ASSERT_LT(trader->cold->trades_history[0].pnl, 0.0);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 0.01);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
 TEST_F(TraderTest, UpdateWithInactiveTrader)
 {
     // Set the duration without trade to the threshold
-    trader->duration_without_trade = config.training.inactive_trader_threshold.value();
+    trader->duration_without_trade = config.training.inactive_trader_threshold;
 
     // Call the update method
     trader->update(trader->candles);
@@ -245,15 +244,15 @@ TEST_F(TraderTest, UpdateWithInactiveTrader)
     // Check if the position is closed and open orders are cleared
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->open_orders.size(), 0);
-    ASSERT_EQ(trader->trades_history.size(), 0);
-    ASSERT_EQ(trader->duration_without_trade, config.training.inactive_trader_threshold.value() + 1);
+    ASSERT_EQ(trader->cold->trades_history.size(), 0);
+    ASSERT_EQ(trader->duration_without_trade, config.training.inactive_trader_threshold + 1);
     ASSERT_TRUE(trader->dead);
 }
 
 TEST_F(TraderTest, UpdateWithBadTrader)
 {
     // Mock data for testing
-    trader->balance = config.training.bad_trader_threshold.value() * config.general.initial_balance;
+    trader->balance = config.training.bad_trader_threshold * config.general.initial_balance;
 
     // Call the update method
     trader->update(trader->candles);
@@ -266,7 +265,7 @@ TEST_F(TraderTest, CheckTpOrderHit)
 {
     // Mock data
     trader->candles = {{TimeFrame::M15, {
-                                            Candle{.close = 1.00500, .high = 1.00600, .low = 0.99900, .spread = 2},
+                                            Candle{.high = 1.00600, .low = 0.99900, .close = 1.00500, .spread = 2},
                                         }}};
 
     // Simulate a long position
@@ -293,16 +292,16 @@ TEST_F(TraderTest, CheckTpOrderHit)
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->balance, new_balance);
     ASSERT_EQ(trader->open_orders.size(), 0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].exit_price, 1.00500);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::LONG);
-    ASSERT_EQ(trader->trades_history[0].pnl, pnl);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 1.0);
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].exit_price, 1.00500);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::LONG);
+    ASSERT_EQ(trader->cold->trades_history[0].pnl, pnl);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 1.0);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
@@ -310,7 +309,7 @@ TEST_F(TraderTest, CheckSlOrderHit)
 {
     // Mock data
     trader->candles = {{TimeFrame::M15, {
-                                            Candle{.close = 0.99400, .high = 1.00500, .low = 0.99300, .spread = 2},
+                                            Candle{.high = 1.00500, .low = 0.99300, .close = 0.99400, .spread = 2},
                                         }}};
 
     // Simulate a long position
@@ -337,16 +336,16 @@ TEST_F(TraderTest, CheckSlOrderHit)
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->balance, new_balance);
     ASSERT_EQ(trader->open_orders.size(), 0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].exit_price, 0.99500);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::LONG);
-    ASSERT_EQ(trader->trades_history[0].pnl, pnl);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 1.0);
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].exit_price, 0.99500);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::LONG);
+    ASSERT_EQ(trader->cold->trades_history[0].pnl, pnl);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 1.0);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
@@ -370,16 +369,16 @@ TEST_F(TraderTest, TradeCloseLongWithProfit)
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->balance, new_balance);
     ASSERT_EQ(trader->open_orders.size(), 0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].exit_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::LONG);
-    ASSERT_EQ(trader->trades_history[0].pnl, pnl);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 1.0);
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].exit_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::LONG);
+    ASSERT_EQ(trader->cold->trades_history[0].pnl, pnl);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 1.0);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
@@ -403,16 +402,16 @@ TEST_F(TraderTest, TradeCloseLongWithLoss)
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->balance, new_balance);
     ASSERT_EQ(trader->open_orders.size(), 0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].exit_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::LONG);
-    ASSERT_EQ(trader->trades_history[0].pnl, pnl);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 1.0);
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].exit_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::LONG);
+    ASSERT_EQ(trader->cold->trades_history[0].pnl, pnl);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 1.0);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
@@ -436,16 +435,16 @@ TEST_F(TraderTest, TradeCloseShortWithProfit)
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->balance, new_balance);
     ASSERT_EQ(trader->open_orders.size(), 0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].exit_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::SHORT);
-    ASSERT_EQ(trader->trades_history[0].pnl, pnl);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 1.0);
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].exit_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::SHORT);
+    ASSERT_EQ(trader->cold->trades_history[0].pnl, pnl);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 1.0);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
@@ -469,16 +468,16 @@ TEST_F(TraderTest, TradeCloseShortWithLoss)
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->balance, new_balance);
     ASSERT_EQ(trader->open_orders.size(), 0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].exit_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::SHORT);
-    ASSERT_EQ(trader->trades_history[0].pnl, pnl);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 1.0);
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].exit_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::SHORT);
+    ASSERT_EQ(trader->cold->trades_history[0].pnl, pnl);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 1.0);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
@@ -499,13 +498,13 @@ TEST_F(TraderTest, TradeEnterLong)
     ASSERT_EQ(trader->duration_in_position, 0);
     ASSERT_EQ(trader->open_orders.size(), 2);
     ASSERT_LE(trader->balance, 1000.0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::LONG);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, trader->current_position->size);
-    ASSERT_FALSE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::LONG);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, trader->current_position->size);
+    ASSERT_FALSE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 0);
 }
 
@@ -525,13 +524,13 @@ TEST_F(TraderTest, TradeEnterShort)
     ASSERT_EQ(trader->duration_in_position, 0);
     ASSERT_EQ(trader->open_orders.size(), 2);
     ASSERT_LE(trader->balance, 1000.0);
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.0);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::SHORT);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, trader->current_position->size);
-    ASSERT_FALSE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::SHORT);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, trader->current_position->size);
+    ASSERT_FALSE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 0);
 }
 
@@ -557,7 +556,7 @@ TEST_F(TraderTest, ClosePositionForDurationExceeded)
     trader->update_position_pnl();
 
     // Set the duration in position to the maximum trade duration
-    trader->duration_in_position = config.strategy.maximum_trade_duration.value() - 1;
+    trader->duration_in_position = config.strategy.maximum_trade_duration - 1;
 
     // Call the update method
     time_t new_date = date + get_time_frame_in_minutes(config.strategy.timeframe) * 60;
@@ -567,17 +566,17 @@ TEST_F(TraderTest, ClosePositionForDurationExceeded)
     // Assertions
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_LT(trader->balance, 1000.0); // Balance decreased due to fees
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, new_date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.01);
-    ASSERT_EQ(trader->trades_history[0].exit_price, 1.00);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::LONG);
-    ASSERT_NE(trader->trades_history[0].pnl, 0.0);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 1.0);
-    ASSERT_LE(trader->trades_history[0].duration, config.strategy.maximum_trade_duration.value());
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(new_date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.01);
+    ASSERT_EQ(trader->cold->trades_history[0].exit_price, 1.00);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::LONG);
+    ASSERT_NE(trader->cold->trades_history[0].pnl, 0.0);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 1.0);
+    ASSERT_LE(trader->cold->trades_history[0].duration, config.strategy.maximum_trade_duration);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
@@ -587,14 +586,14 @@ TEST_F(TraderTest, WaitForDurationBeforeClosePosition)
     trader->decisions = {0.0, 1.0, 0.0};
 
     // Call the update method for the maximum trade duration - 1
-    for (int i = 0; i < config.strategy.maximum_trade_duration.value() - 1; ++i)
+    for (int i = 0; i < config.strategy.maximum_trade_duration - 1; ++i)
     {
         trader->update(trader->candles);
     }
 
     // Assertions
     ASSERT_NE(trader->current_position, nullptr);
-    ASSERT_EQ(trader->duration_in_position, config.strategy.maximum_trade_duration.value() - 1);
+    ASSERT_EQ(trader->duration_in_position, config.strategy.maximum_trade_duration - 1);
     ASSERT_EQ(trader->nb_trades_today, 0);
 
     // Call the update method for the last trade duration
@@ -603,16 +602,16 @@ TEST_F(TraderTest, WaitForDurationBeforeClosePosition)
     // Assertions
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_LT(trader->balance, 1000.0); // Balance decreased due to fees
-    ASSERT_EQ(trader->trades_history.size(), 1);
-    ASSERT_EQ(trader->trades_history[0].entry_date, date);
-    ASSERT_EQ(trader->trades_history[0].exit_date, date);
-    ASSERT_EQ(trader->trades_history[0].entry_price, 1.00);
-    ASSERT_EQ(trader->trades_history[0].exit_price, 1.00);
-    ASSERT_EQ(trader->trades_history[0].side, PositionSide::LONG);
-    ASSERT_GT(trader->trades_history[0].fees, 0.0);
-    ASSERT_EQ(trader->trades_history[0].size, 1.0);
-    ASSERT_EQ(trader->trades_history[0].duration, config.strategy.maximum_trade_duration.value());
-    ASSERT_TRUE(trader->trades_history[0].closed);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history[0].entry_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].exit_date, to_minute(date));
+    ASSERT_EQ(trader->cold->trades_history[0].entry_price, 1.00);
+    ASSERT_EQ(trader->cold->trades_history[0].exit_price, 1.00);
+    ASSERT_EQ(trader->cold->trades_history[0].side, PositionSide::LONG);
+    ASSERT_GT(trader->cold->trades_history[0].fees, 0.0);
+    ASSERT_EQ(trader->cold->trades_history[0].size, 1.0);
+    ASSERT_EQ(trader->cold->trades_history[0].duration, config.strategy.maximum_trade_duration);
+    ASSERT_TRUE(trader->cold->trades_history[0].closed);
     ASSERT_EQ(trader->nb_trades_today, 1);
 }
 
@@ -629,7 +628,7 @@ TEST_F(TraderTest, WaitForNextTrade)
     ASSERT_EQ(trader->nb_trades_today, 0);
 
     // Set trader's date after the minimum duration before next trade has passed
-    trader->duration_without_trade = config.strategy.minimum_duration_before_next_trade.value();
+    trader->duration_without_trade = config.strategy.minimum_duration_before_next_trade;
 
     // Call the trade method
     trader->trade();
@@ -663,7 +662,7 @@ TEST_F(TraderTest, CloseTradeBeforeRestDay)
     ASSERT_EQ(trader->current_position, nullptr);
     ASSERT_EQ(trader->nb_trades_today, 1);
     ASSERT_LE(trader->balance, 1000.0); // Balance decreased due to fees
-    ASSERT_EQ(trader->trades_history.size(), 1);
+    ASSERT_EQ(trader->cold->trades_history.size(), 1);
 }
 
 TEST_F(TraderTest, CreateTpSlForLongPosition)
@@ -801,7 +800,7 @@ TEST_F(TraderTest, TradeNotWhenSpreadHigh)
 
     // Mock data for testing
     trader->candles = {{TimeFrame::M15, {
-                                            Candle{.date = date, .close = 1.0, .spread = config.strategy.maximum_spread.value() + 1},
+                                            Candle{.date = date, .close = 1.0, .spread = static_cast<float>(config.strategy.maximum_spread + 1)},
                                         }}};
 
     // Call the trade method
@@ -819,7 +818,7 @@ TEST_F(TraderTest, RespectNumberOfTradesPerDay)
     trader->decisions = {1.0, 0.0, 0.0};
 
     // Trade the maximum number of trades per day
-    for (int i = 0; i < config.strategy.maximum_trades_per_day.value(); ++i)
+    for (int i = 0; i < config.strategy.maximum_trades_per_day; ++i)
     {
         // Check if the trader can trade
         ASSERT_TRUE(trader->can_trade());
@@ -835,7 +834,7 @@ TEST_F(TraderTest, RespectNumberOfTradesPerDay)
         ASSERT_EQ(trader->current_position, nullptr);
 
         // Set the duration without trade to the minimum duration before next trade
-        trader->duration_without_trade = config.strategy.minimum_duration_before_next_trade.value();
+        trader->duration_without_trade = config.strategy.minimum_duration_before_next_trade;
 
         // Check if the nb of trades today is updated
         ASSERT_EQ(trader->nb_trades_today, i + 1);
@@ -849,7 +848,7 @@ TEST_F(TraderTest, RespectNumberOfTradesPerDay)
 
     // Check if no new position is opened
     ASSERT_EQ(trader->current_position, nullptr);
-    ASSERT_EQ(trader->nb_trades_today, config.strategy.maximum_trades_per_day.value());
+    ASSERT_EQ(trader->nb_trades_today, config.strategy.maximum_trades_per_day);
 }
 
 TEST_F(TraderTest, UpdateLongPositionPnl)
@@ -858,7 +857,7 @@ TEST_F(TraderTest, UpdateLongPositionPnl)
     trader->candles = {{TimeFrame::M15, {
                                             Candle{.date = date, .close = 1.00100},
                                         }}};
-    trader->current_position = new Position{.entry_date = date, .entry_price = 1.00000, .size = 1.0, .side = PositionSide::LONG, .pnl = 0.0};
+    trader->current_position = new Position{.side = PositionSide::LONG, .size = 1.0, .entry_price = 1.00000, .entry_date = date, .pnl = 0.0};
 
     // Call the update_position_pnl method
     trader->update_position_pnl();
@@ -873,7 +872,7 @@ TEST_F(TraderTest, UpdateShortPositionPnl)
     trader->candles = {{TimeFrame::M15, {
                                             Candle{.date = date, .close = 0.99900},
                                         }}};
-    trader->current_position = new Position{.entry_date = date, .entry_price = 1.00000, .size = 1.0, .side = PositionSide::SHORT, .pnl = 0.0};
+    trader->current_position = new Position{.side = PositionSide::SHORT, .size = 1.0, .entry_price = 1.00000, .entry_date = date, .pnl = 0.0};
 
     // Call the update_position_pnl method
     trader->update_position_pnl();
@@ -993,14 +992,14 @@ TEST_F(TraderTest, TrailingStopLossForShort)
 TEST_F(TraderTest, CalculateFitness)
 {
     // Mock data for testing
-    trader->stats.total_trades = 15;
-    trader->stats.max_drawdown = 0.03;
-    trader->stats.profit_factor = 1.8;
-    trader->stats.win_rate = 0.6;
-    trader->stats.average_profit = 0.025;
-    trader->stats.average_loss = 0.015;
-    trader->stats.sharpe_ratio = 1.5;
-    trader->trades_history = {
+    trader->cold->stats.total_trades = 15;
+    trader->cold->stats.max_drawdown = 0.03;
+    trader->cold->stats.profit_factor = 1.8;
+    trader->cold->stats.win_rate = 0.6;
+    trader->cold->stats.average_profit = 0.025;
+    trader->cold->stats.average_loss = 0.015;
+    trader->cold->stats.sharpe_ratio = 1.5;
+    trader->cold->trades_history = {
         {.pnl_percent = 0.1, .closed = true},
         {.pnl_percent = -0.05, .closed = true},
         {.pnl_percent = -0.1, .closed = true},
@@ -1030,70 +1029,70 @@ TEST_F(TraderTest, JSON)
     ASSERT_EQ(trader->generation, trader_copy->generation);
     ASSERT_TRUE(trader->genome->is_equal(trader_copy->genome));
 
-    ASSERT_EQ(trader->stats.initial_balance, trader_copy->stats.initial_balance);
-    ASSERT_EQ(trader->stats.final_balance, trader_copy->stats.final_balance);
-    ASSERT_EQ(trader->stats.performance, trader_copy->stats.performance);
-    ASSERT_EQ(trader->stats.total_net_profit, trader_copy->stats.total_net_profit);
-    ASSERT_EQ(trader->stats.total_profit, trader_copy->stats.total_profit);
-    ASSERT_EQ(trader->stats.total_loss, trader_copy->stats.total_loss);
-    ASSERT_EQ(trader->stats.total_fees, trader_copy->stats.total_fees);
-    ASSERT_EQ(trader->stats.total_trades, trader_copy->stats.total_trades);
-    ASSERT_EQ(trader->stats.total_long_trades, trader_copy->stats.total_long_trades);
-    ASSERT_EQ(trader->stats.total_short_trades, trader_copy->stats.total_short_trades);
-    ASSERT_EQ(trader->stats.total_winning_trades, trader_copy->stats.total_winning_trades);
-    ASSERT_EQ(trader->stats.total_winning_long_trades, trader_copy->stats.total_winning_long_trades);
-    ASSERT_EQ(trader->stats.total_winning_short_trades, trader_copy->stats.total_winning_short_trades);
-    ASSERT_EQ(trader->stats.total_losing_trades, trader_copy->stats.total_losing_trades);
-    ASSERT_EQ(trader->stats.total_losing_long_trades, trader_copy->stats.total_losing_long_trades);
-    ASSERT_EQ(trader->stats.max_consecutive_winning_trades, trader_copy->stats.max_consecutive_winning_trades);
-    ASSERT_EQ(trader->stats.max_consecutive_losing_trades, trader_copy->stats.max_consecutive_losing_trades);
-    ASSERT_EQ(trader->stats.profit_factor, trader_copy->stats.profit_factor);
-    ASSERT_EQ(trader->stats.max_drawdown, trader_copy->stats.max_drawdown);
-    ASSERT_EQ(trader->stats.win_rate, trader_copy->stats.win_rate);
-    ASSERT_EQ(trader->stats.long_win_rate, trader_copy->stats.long_win_rate);
-    ASSERT_EQ(trader->stats.average_profit, trader_copy->stats.average_profit);
-    ASSERT_EQ(trader->stats.average_loss, trader_copy->stats.average_loss);
-    ASSERT_EQ(trader->stats.max_profit, trader_copy->stats.max_profit);
-    ASSERT_EQ(trader->stats.max_loss, trader_copy->stats.max_loss);
-    ASSERT_EQ(trader->stats.max_consecutive_profit, trader_copy->stats.max_consecutive_profit);
-    ASSERT_EQ(trader->stats.max_consecutive_loss, trader_copy->stats.max_consecutive_loss);
-    ASSERT_EQ(trader->stats.average_trade_duration, trader_copy->stats.average_trade_duration);
-    ASSERT_EQ(trader->stats.sharpe_ratio, trader_copy->stats.sharpe_ratio);
-    ASSERT_EQ(trader->stats.sortino_ratio, trader_copy->stats.sortino_ratio);
-    ASSERT_EQ(trader->stats.monthly_returns.size(), trader_copy->stats.monthly_returns.size());
-    for (const auto &[key, value] : trader->stats.monthly_returns)
+    ASSERT_EQ(trader->cold->stats.initial_balance, trader_copy->cold->stats.initial_balance);
+    ASSERT_EQ(trader->cold->stats.final_balance, trader_copy->cold->stats.final_balance);
+    ASSERT_EQ(trader->cold->stats.performance, trader_copy->cold->stats.performance);
+    ASSERT_EQ(trader->cold->stats.total_net_profit, trader_copy->cold->stats.total_net_profit);
+    ASSERT_EQ(trader->cold->stats.total_profit, trader_copy->cold->stats.total_profit);
+    ASSERT_EQ(trader->cold->stats.total_loss, trader_copy->cold->stats.total_loss);
+    ASSERT_EQ(trader->cold->stats.total_fees, trader_copy->cold->stats.total_fees);
+    ASSERT_EQ(trader->cold->stats.total_trades, trader_copy->cold->stats.total_trades);
+    ASSERT_EQ(trader->cold->stats.total_long_trades, trader_copy->cold->stats.total_long_trades);
+    ASSERT_EQ(trader->cold->stats.total_short_trades, trader_copy->cold->stats.total_short_trades);
+    ASSERT_EQ(trader->cold->stats.total_winning_trades, trader_copy->cold->stats.total_winning_trades);
+    ASSERT_EQ(trader->cold->stats.total_winning_long_trades, trader_copy->cold->stats.total_winning_long_trades);
+    ASSERT_EQ(trader->cold->stats.total_winning_short_trades, trader_copy->cold->stats.total_winning_short_trades);
+    ASSERT_EQ(trader->cold->stats.total_losing_trades, trader_copy->cold->stats.total_losing_trades);
+    ASSERT_EQ(trader->cold->stats.total_losing_long_trades, trader_copy->cold->stats.total_losing_long_trades);
+    ASSERT_EQ(trader->cold->stats.max_consecutive_winning_trades, trader_copy->cold->stats.max_consecutive_winning_trades);
+    ASSERT_EQ(trader->cold->stats.max_consecutive_losing_trades, trader_copy->cold->stats.max_consecutive_losing_trades);
+    ASSERT_EQ(trader->cold->stats.profit_factor, trader_copy->cold->stats.profit_factor);
+    ASSERT_EQ(trader->cold->stats.max_drawdown, trader_copy->cold->stats.max_drawdown);
+    ASSERT_EQ(trader->cold->stats.win_rate, trader_copy->cold->stats.win_rate);
+    ASSERT_EQ(trader->cold->stats.long_win_rate, trader_copy->cold->stats.long_win_rate);
+    ASSERT_EQ(trader->cold->stats.average_profit, trader_copy->cold->stats.average_profit);
+    ASSERT_EQ(trader->cold->stats.average_loss, trader_copy->cold->stats.average_loss);
+    ASSERT_EQ(trader->cold->stats.max_profit, trader_copy->cold->stats.max_profit);
+    ASSERT_EQ(trader->cold->stats.max_loss, trader_copy->cold->stats.max_loss);
+    ASSERT_EQ(trader->cold->stats.max_consecutive_profit, trader_copy->cold->stats.max_consecutive_profit);
+    ASSERT_EQ(trader->cold->stats.max_consecutive_loss, trader_copy->cold->stats.max_consecutive_loss);
+    ASSERT_EQ(trader->cold->stats.average_trade_duration, trader_copy->cold->stats.average_trade_duration);
+    ASSERT_EQ(trader->cold->stats.sharpe_ratio, trader_copy->cold->stats.sharpe_ratio);
+    ASSERT_EQ(trader->cold->stats.sortino_ratio, trader_copy->cold->stats.sortino_ratio);
+    ASSERT_EQ(trader->cold->stats.monthly_returns.size(), trader_copy->cold->stats.monthly_returns.size());
+    for (const auto &[key, value] : trader->cold->stats.monthly_returns)
     {
-        ASSERT_EQ(trader_copy->stats.monthly_returns[key], value);
+        ASSERT_EQ(trader_copy->cold->stats.monthly_returns[key], value);
     }
 
-    ASSERT_EQ(trader->balance_history.size(), trader_copy->balance_history.size());
-    for (size_t i = 0; i < trader->balance_history.size(); ++i)
+    ASSERT_EQ(trader->cold->balance_history.size(), trader_copy->cold->balance_history.size());
+    for (size_t i = 0; i < trader->cold->balance_history.size(); ++i)
     {
-        ASSERT_EQ(trader->balance_history[i], trader_copy->balance_history[i]);
+        ASSERT_EQ(trader->cold->balance_history[i], trader_copy->cold->balance_history[i]);
     }
 
-    ASSERT_EQ(trader->trades_history.size(), trader_copy->trades_history.size());
-    for (size_t i = 0; i < trader->trades_history.size(); ++i)
+    ASSERT_EQ(trader->cold->trades_history.size(), trader_copy->cold->trades_history.size());
+    for (size_t i = 0; i < trader->cold->trades_history.size(); ++i)
     {
-        ASSERT_EQ(trader->trades_history[i].side, trader_copy->trades_history[i].side);
-        ASSERT_EQ(trader->trades_history[i].entry_date, trader_copy->trades_history[i].entry_date);
-        ASSERT_EQ(trader->trades_history[i].exit_date, trader_copy->trades_history[i].exit_date);
-        ASSERT_EQ(trader->trades_history[i].entry_price, trader_copy->trades_history[i].entry_price);
-        ASSERT_EQ(trader->trades_history[i].exit_price, trader_copy->trades_history[i].exit_price);
-        ASSERT_EQ(trader->trades_history[i].size, trader_copy->trades_history[i].size);
-        ASSERT_EQ(trader->trades_history[i].pnl, trader_copy->trades_history[i].pnl);
-        ASSERT_EQ(trader->trades_history[i].pnl_percent, trader_copy->trades_history[i].pnl_percent);
-        ASSERT_EQ(trader->trades_history[i].pnl_net_percent, trader_copy->trades_history[i].pnl_net_percent);
-        ASSERT_EQ(trader->trades_history[i].fees, trader_copy->trades_history[i].fees);
-        ASSERT_EQ(trader->trades_history[i].duration, trader_copy->trades_history[i].duration);
-        ASSERT_EQ(trader->trades_history[i].closed, trader_copy->trades_history[i].closed);
+        ASSERT_EQ(trader->cold->trades_history[i].side, trader_copy->cold->trades_history[i].side);
+        ASSERT_EQ(trader->cold->trades_history[i].entry_date, trader_copy->cold->trades_history[i].entry_date);
+        ASSERT_EQ(trader->cold->trades_history[i].exit_date, trader_copy->cold->trades_history[i].exit_date);
+        ASSERT_EQ(trader->cold->trades_history[i].entry_price, trader_copy->cold->trades_history[i].entry_price);
+        ASSERT_EQ(trader->cold->trades_history[i].exit_price, trader_copy->cold->trades_history[i].exit_price);
+        ASSERT_EQ(trader->cold->trades_history[i].size, trader_copy->cold->trades_history[i].size);
+        ASSERT_EQ(trader->cold->trades_history[i].pnl, trader_copy->cold->trades_history[i].pnl);
+        ASSERT_EQ(trader->cold->trades_history[i].pnl_percent, trader_copy->cold->trades_history[i].pnl_percent);
+        ASSERT_EQ(trader->cold->trades_history[i].pnl_net_percent, trader_copy->cold->trades_history[i].pnl_net_percent);
+        ASSERT_EQ(trader->cold->trades_history[i].fees, trader_copy->cold->trades_history[i].fees);
+        ASSERT_EQ(trader->cold->trades_history[i].duration, trader_copy->cold->trades_history[i].duration);
+        ASSERT_EQ(trader->cold->trades_history[i].closed, trader_copy->cold->trades_history[i].closed);
     }
 }
 
 TEST_F(TraderTest, GenerateBalanceHistoryGraph)
 {
     // Mock data for testing
-    trader->balance_history = {1000.0, 900.0, 1100.0, 1000.0};
+    trader->cold->balance_history = {1000.0, 900.0, 1100.0, 1000.0};
 
     // Call the generate_balance_history_graphic method
     std::filesystem::path file = "reports/tests/trader_balance_history.png";
@@ -1108,10 +1107,10 @@ TEST_F(TraderTest, GenerateBalanceHistoryGraph)
 
 TEST_F(TraderTest, GenerateReport)
 {
-    trader->trades_history = {
-        {.entry_date = date, .exit_date = date, .entry_price = 1.0, .exit_price = 0.99500, .side = PositionSide::LONG, .pnl = -50.0, .fees = 0.5, .size = 1.0, .closed = true},
+    trader->cold->trades_history = {
+        {.entry_date = to_minute(date), .exit_date = to_minute(date), .entry_price = 1.0, .exit_price = 0.99500, .size = 1.0, .pnl = -50.0, .fees = 0.5, .side = PositionSide::LONG, .closed = true},
     };
-    trader->balance_history = {1000.0, 950.0};
+    trader->cold->balance_history = {1000.0, 950.0};
 
     // Mock data for testing
     trader->calculate_stats();
@@ -63,9 +63,9 @@ protected:
                 .name = "test",
                 .version = "1.0",
                 .symbol = "EURUSD",
-                .leverage = 100,
                 .initial_balance = 1000,
                 .account_currency = "USD",
+                .leverage = 100,
             },
             .strategy = {
                 .timeframe = TimeFrame::M15,
@@ -116,11 +116,11 @@ protected:
             },
             .evaluation = {
                 .maximum_trade_duration = 5,
-                .maximum_drawdown = 0.1,
                 .expected_return_per_day = 0.01,
                 .expected_return_per_month = 0.1,
-                .minimum_profit_factor = 2,
+                .maximum_drawdown = 0.1,
                 .minimum_winrate = 0.5,
+                .minimum_profit_factor = 2,
             },
             .neat = neat::load_config("src/configs/neat_config.txt"),
         };
@@ -189,10 +189,6 @@ TEST_F(TrainingTest, LoadCandles)
 
         ASSERT_TRUE(training->candles.find(date) != training->candles.end());
 
-        ASSERT_TRUE(training->candles[date].find(TimeFrame::M15) != training->candles[date].end());
-        ASSERT_TRUE(training->candles[date].find(TimeFrame::M30) != training->candles[date].end());
-        ASSERT_TRUE(training->candles[date].find(TimeFrame::H1) != training->candles[date].end());
-
         ASSERT_FALSE(training->candles[date][TimeFrame::M15].empty());
         ASSERT_FALSE(training->candles[date][TimeFrame::M30].empty());
         ASSERT_FALSE(training->candles[date][TimeFrame::H1].empty());
@@ -211,24 +207,24 @@ TEST_F(TrainingTest, LoadIndicators)
 {
     training->load_candles();
     training->load_indicators();
-    int nb_indicators = training->config.training.inputs.indicators.size();
 
     ASSERT_FALSE(training->indicators.empty());
 
     for (const auto &[date, indicators_data] : training->indicators)
     {
         ASSERT_FALSE(indicators_data.empty());
-        for (const auto &[tf, data] : indicators_data)
+        for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
         {
+            const auto &data = indicators_data[static_cast<TimeFrame>(i)];
             for (const auto &[id, values] : data)
             {
                 ASSERT_EQ(values.size(), INDICATOR_WINDOW);
             }
         }
 
-        ASSERT_TRUE(training->indicators[date].find(TimeFrame::M15) != training->indicators[date].end());
-        ASSERT_TRUE(training->indicators[date].find(TimeFrame::M30) != training->indicators[date].end());
-        ASSERT_TRUE(training->indicators[date].find(TimeFrame::H1) != training->indicators[date].end());
+        ASSERT_FALSE(training->indicators[date][TimeFrame::M15].empty());
+        ASSERT_FALSE(training->indicators[date][TimeFrame::M30].empty());
+        ASSERT_FALSE(training->indicators[date][TimeFrame::H1].empty());
         ASSERT_EQ(training->indicators[date][TimeFrame::M15].size(), 2);
         ASSERT_EQ(training->indicators[date][TimeFrame::M30].size(), 2);
         ASSERT_EQ(training->indicators[date][TimeFrame::H1].size(), 2);
@@ -274,20 +270,27 @@ TEST_F(TrainingTest, CacheData)
     for (const auto &date : dates)
     {
         std::string date_string = std::to_string(date);
+        CachedData cached_data = training->cache->get(date_string);
 
-        for (const auto &[timeframe, candles] : training->cache->get(date_string).candles)
+        for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
         {
-            // Check the candles are not empty
-            ASSERT_FALSE(candles.empty());
+            TimeFrame timeframe = static_cast<TimeFrame>(i);
+            const std::vector<Candle> &candles = cached_data.candles[timeframe];
+
+            // Skip the timeframes without data
+            if (candles.empty())
+            {
+                continue;
+            }
 
             // Check the last candle date
             if (timeframe == loop_timeframe)
             {
-                ASSERT_EQ(training->cache->get(date_string).candles[timeframe].back().date, date);
+                ASSERT_EQ(candles.back().date, date);
             }
             else
             {
-                ASSERT_LE(training->cache->get(date_string).candles[timeframe].back().date, date);
+                ASSERT_LE(candles.back().date, date);
             }
 
             // Check the the candle dates are well ordered
@@ -298,8 +301,9 @@ TEST_F(TrainingTest, CacheData)
         }
 
         // Check the the indicators are in the cache
-        for (const auto &[timeframe, indicators_data] : training->cache->get(date_string).indicators)
+        for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
         {
+            const auto &indicators_data = cached_data.indicators[static_cast<TimeFrame>(i)];
             for (const auto &[id, data] : indicators_data)
             {
                 ASSERT_EQ(data.size(), INDICATOR_WINDOW);
@@ -377,10 +381,10 @@ TEST_F(TrainingTest, MonteCarloSimulation)
     // Mock the trader
     neat::Genome *genome = new neat::Genome();
     Trader *trader = new Trader(genome, config);
-    trader->stats.win_rate = 0.5;
-    trader->stats.profit_factor = 2;
-    trader->stats.total_trades = 20;
-    trader->stats.final_balance = config.general.initial_balance;
+    trader->cold->stats.win_rate = 0.5;
+    trader->cold->stats.profit_factor = 2;
+    trader->cold->stats.total_trades = 20;
+    trader->cold->stats.final_balance = config.general.initial_balance;
 
     training->load_candles();
     training->load_indicators();
@@ -20,6 +20,7 @@
 #include "trading/schedule.hpp"
 #include "trading/tools.hpp"
 #include "trading/stats.hpp"
+#include "trading/trade_pool.hpp"
 #include "indicators/utils.hpp"
 #include "symbols.hpp"
 #include "trader.hpp"
@@ -38,6 +39,10 @@ bool operator==(const Trade &t1, const Trade &t2)
  */
 Trader::Trader(neat::Genome *genome, Config config, Logger *logger)
 {
+    // Cold state lives behind a pointer so the hot fields pack tightly
+    this->cold = std::make_unique<TraderCold>();
+    this->cold->trades_history = global_trade_pool().acquire();
+
     if (genome == nullptr)
     {
         std::cerr << "Genome object is null." << std::endl;
@@ -53,23 +58,35 @@ Trader::Trader(neat::Genome *genome, Config config, Logger *logger)
     this->current_date = 0;
     this->current_base_currency_conversion_rate = 1.0;
 
-    // History
-    this->balance_history = {};
-    this->trades_history = {};
+    // History (the trades history holds the pooled vector acquired above)
+    this->cold->balance_history = {};
 
     // Trading stuff
     this->balance = config.general.initial_balance;
     this->open_orders = {};
     this->current_position = nullptr;
     this->duration_in_position = 0;
-    this->duration_without_trade = this->config.strategy.minimum_duration_before_next_trade.value_or(0);
+    this->duration_without_trade = value_or(this->config.strategy.minimum_duration_before_next_trade, 0);
     this->nb_trades_today = 0;
 
     // Statistics of the trader
-    this->stats = Stats(config.general.initial_balance);
+    this->cold->stats = Stats(config.general.initial_balance);
 
     // Fiteness evaluation details
-    this->fitness_details = {};
+    this->cold->fitness_details = {};
+
+    // Resolve the network inputs once: the indicator set is frozen after the
+    // config parse, so look() walks this flat list instead of rebuilding the
+    // reverse key string and re-testing the strategy flags on every call
+    this->include_reverse_inputs = (this->config.strategy.can_open_long_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false)) || (this->config.strategy.can_open_short_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false)) || (this->config.strategy.can_open_long_trade.value_or(true) && this->config.strategy.can_open_short_trade.value_or(true));
+    for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
+    {
+        TimeFrame tf = static_cast<TimeFrame>(i);
+        for (const Indicator *indicator : this->config.training.inputs.indicators[tf])
+        {
+            this->network_inputs.push_back(NetworkInput{tf, indicator->id, indicator->id + "-reverse"});
+        }
+    }
 
     // Neat stuffs
     this->generation = 0;
@@ -87,6 +104,9 @@ Trader::Trader(neat::Genome *genome, Config config, Logger *logger)
  */
 Trader::~Trader()
 {
+    // Recycle the trade history so the next trader reuses its capacity
+    global_trade_pool().release(std::move(this->cold->trades_history));
+
     if (this->logger != nullptr)
     {
         delete this->logger;
@@ -99,20 +119,19 @@ Trader::~Trader()
  * @param base_currency_conversion_rate Conversion rate when the base asset traded is different from the account currency.
  * @param position_infos Vector of position information.
  */
-void Trader::look(IndicatorsData &indicators_data, double base_currency_conversion_rate, std::vector<PositionInfo> position_infos)
+void Trader::look(const IndicatorsData &indicators_data, double base_currency_conversion_rate, const std::vector<PositionInfo> &position_infos)
 {
     std::vector<double> indicators_values = {};
+    indicators_values.reserve(this->network_inputs.size() * (this->include_reverse_inputs ? 2 : 1));
     this->current_base_currency_conversion_rate = base_currency_conversion_rate;
 
-    for (const auto &[tf, indicators] : this->config.training.inputs.indicators)
+    for (const NetworkInput &input : this->network_inputs)
     {
-        for (const auto &indicator : indicators)
+        const auto &tf_values = indicators_data[input.time_frame];
+        indicators_values.push_back(tf_values.at(input.id).back());
+        if (this->include_reverse_inputs)
         {
-            indicators_values.push_back(indicators_data[tf][indicator->id].back());
-            if ((this->config.strategy.can_open_long_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false)) || (this->config.strategy.can_open_short_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false)) || (this->config.strategy.can_open_long_trade.value_or(true) && this->config.strategy.can_open_short_trade.value_or(true)))
-            {
-                indicators_values.push_back(indicators_data[tf][indicator->id + "-reverse"].back());
-            }
+            indicators_values.push_back(tf_values.at(input.reverse_id).back());
         }
     }
 
@@ -146,9 +165,9 @@ void Trader::look(IndicatorsData &indicators_data, double base_currency_conversi
         }
         else if (info == PositionInfo::DURATION)
         {
-            if (this->config.strategy.maximum_trade_duration.has_value())
+            if (is_set(this->config.strategy.maximum_trade_duration))
             {
-                position_info.push_back(static_cast<double>(this->duration_in_position) / static_cast<double>(this->config.strategy.maximum_trade_duration.value_or(1)));
+                position_info.push_back(static_cast<double>(this->duration_in_position) / static_cast<double>(value_or(this->config.strategy.maximum_trade_duration, 1)));
             }
             else
             {
@@ -198,7 +217,7 @@ void Trader::think()
  *
  * @param candles Candle data for all time frames.
  */
-void Trader::update(CandlesData &candles)
+void Trader::update(const CandlesData &candles)
 {
     if (candles.empty())
     {
@@ -254,10 +273,10 @@ void Trader::update(CandlesData &candles)
     this->check_position_liquidation();
 
     // Check the duration of the current trade
-    if (this->current_position != nullptr && config.strategy.maximum_trade_duration.has_value())
+    if (this->current_position != nullptr && is_set(config.strategy.maximum_trade_duration))
     {
         // Check if the position has reached the maximum trade duration
-        if (this->duration_in_position >= config.strategy.maximum_trade_duration.value())
+        if (this->duration_in_position >= config.strategy.maximum_trade_duration)
         {
             this->close_position_by_market();
             if (this->logger != nullptr)
@@ -287,10 +306,10 @@ void Trader::update(CandlesData &candles)
     this->lifespan++;
 
     // Kill the traders that loose too much money
-    bool bad_trader = this->config.training.bad_trader_threshold.has_value() && balance <= this->stats.initial_balance * config.training.bad_trader_threshold.value();
+    bool bad_trader = is_set(this->config.training.bad_trader_threshold) && balance <= this->cold->stats.initial_balance * config.training.bad_trader_threshold;
 
     // Kill the traders that doesn't trades enough (don't open trade for a long time)
-    bool inactive_trader = this->duration_without_trade >= config.training.inactive_trader_threshold.value_or(std::numeric_limits<int>::max());
+    bool inactive_trader = this->duration_without_trade >= value_or(config.training.inactive_trader_threshold, std::numeric_limits<double>::max());
 
     if (bad_trader || inactive_trader)
     {
@@ -312,7 +331,7 @@ void Trader::update(CandlesData &candles)
     }
 
     // Record the balance to history
-    this->balance_history.push_back(this->balance);
+    this->cold->balance_history.push_back(this->balance);
 
     if (this->logger != nullptr)
     {
@@ -343,20 +362,20 @@ bool Trader::can_trade()
     }
 
     // Check the number of trades made today
-    bool number_of_trades_per_day_is_ok = this->nb_trades_today < this->config.strategy.maximum_trades_per_day.value();
+    bool number_of_trades_per_day_is_ok = this->nb_trades_today < this->config.strategy.maximum_trades_per_day;
 
     // Check if the spread is ok
     bool spread_is_ok = true;
-    if (this->config.strategy.maximum_spread.has_value())
+    if (is_set(this->config.strategy.maximum_spread))
     {
-        spread_is_ok = last_candle.spread <= this->config.strategy.maximum_spread.value();
+        spread_is_ok = last_candle.spread <= this->config.strategy.maximum_spread;
     }
 
     // Check if the time after the previous trade is ok
     bool time_after_previous_trade_is_ok = true;
-    if (this->config.strategy.minimum_duration_before_next_trade.has_value())
+    if (is_set(this->config.strategy.minimum_duration_before_next_trade))
     {
-        time_after_previous_trade_is_ok = this->duration_without_trade >= this->config.strategy.minimum_duration_before_next_trade.value();
+        time_after_previous_trade_is_ok = this->duration_without_trade >= this->config.strategy.minimum_duration_before_next_trade;
     }
 
     return schedule_is_ok && number_of_trades_per_day_is_ok && spread_is_ok && time_after_previous_trade_is_ok;
@@ -377,7 +396,7 @@ int Trader::trade()
     bool has_short_position = has_position && this->current_position->side == PositionSide::SHORT;
 
     // Decision taken
-    double decision_threshold = this->config.training.decision_threshold.value_or(0.0);
+    double decision_threshold = value_or(this->config.training.decision_threshold, 0.0);
     int decision = std::distance(this->decisions.begin(), std::max_element(this->decisions.begin(), this->decisions.end()));
     bool want_long = decision == 0 && this->decisions[0] >= decision_threshold;
     bool want_short = decision == 1 && this->decisions[1] >= decision_threshold;
@@ -395,9 +414,9 @@ int Trader::trade()
         {
             can_close_position = false;
         }
-        else if (this->config.strategy.minimum_trade_duration.has_value())
+        else if (is_set(this->config.strategy.minimum_trade_duration))
         {
-            can_close_position = this->duration_in_position >= this->config.strategy.minimum_trade_duration.value();
+            can_close_position = this->duration_in_position >= this->config.strategy.minimum_trade_duration;
         }
 
         if (can_trade_now)
@@ -482,6 +501,9 @@ void Trader::calculate_fitness()
 {
     EvaluationConfig goals = this->config.evaluation;
 
+    // Reset the details so a re-evaluation does not append duplicate entries
+    this->cold->fitness_details.clear();
+
     double maximum_nb_trades_eval = 0;
     double minimum_nb_trades_eval = 0;
     double max_trade_duration_eval = 0;
@@ -504,7 +526,7 @@ void Trader::calculate_fitness()
 
     // Select only closed trade
     std::vector<Trade> closed_trades = {};
-    for (const auto &trade : this->trades_history)
+    for (const auto &trade : this->cold->trades_history)
     {
         if (trade.closed)
         {
@@ -556,50 +578,50 @@ void Trader::calculate_fitness()
 
     if (goals.maximize_nb_trades.value_or(false))
     {
-        int max_nb_trades = this->config.strategy.maximum_trades_per_day.value() * all_dates.size();
+        int max_nb_trades = this->config.strategy.maximum_trades_per_day * all_dates.size();
         double diff = std::max(0, (int)closed_trades.size() - max_nb_trades);
         double normalized_diff = diff / max_nb_trades;
         maximum_nb_trades_eval = maximum_nb_trades_weight / std::exp(10 * normalized_diff);
     }
 
-    if (goals.minimum_nb_trades.has_value())
+    if (is_set(goals.minimum_nb_trades))
     {
-        double diff = std::max(0, goals.minimum_nb_trades.value() - (int)closed_trades.size());
-        double normalized_diff = diff / goals.minimum_nb_trades.value();
+        double diff = std::max(0, goals.minimum_nb_trades - (int)closed_trades.size());
+        double normalized_diff = diff / goals.minimum_nb_trades;
         minimum_nb_trades_eval = minimum_nb_trades_weight / std::exp(10 * normalized_diff);
     }
 
-    if (goals.maximum_trade_duration.has_value())
+    if (is_set(goals.maximum_trade_duration))
     {
         for (const auto &trade : closed_trades)
         {
-            double diff = std::max(0, trade.duration - goals.maximum_trade_duration.value());
-            double normalized_diff = diff / goals.maximum_trade_duration.value();
+            double diff = std::max(0, trade.duration - goals.maximum_trade_duration);
+            double normalized_diff = diff / goals.maximum_trade_duration;
             max_trade_duration_eval += max_trade_duration_weight / (closed_trades.size() * std::exp(10 * normalized_diff));
         }
     }
 
-    if (goals.maximum_drawdown.has_value())
+    if (is_set(goals.maximum_drawdown))
     {
-        double diff = std::max(0.0, stats.max_drawdown - goals.maximum_drawdown.value());
+        double diff = std::max(0.0, this->cold->stats.max_drawdown - goals.maximum_drawdown);
         max_drawdown_eval = max_drawdown_weight / std::exp(10 * diff);
     }
 
-    if (goals.minimum_profit_factor.has_value())
+    if (is_set(goals.minimum_profit_factor))
     {
-        double diff = std::max(0.0, goals.minimum_profit_factor.value() - stats.profit_factor);
-        double normalized_diff = diff / goals.minimum_profit_factor.value();
+        double diff = std::max(0.0, goals.minimum_profit_factor - this->cold->stats.profit_factor);
+        double normalized_diff = diff / goals.minimum_profit_factor;
         profit_factor_eval = profit_factor_weight / std::exp(10 * normalized_diff);
     }
 
-    if (goals.minimum_winrate.has_value())
+    if (is_set(goals.minimum_winrate))
     {
-        double diff = std::max(0.0, goals.minimum_winrate.value() - stats.win_rate);
-        double normalized_diff = diff / goals.minimum_winrate.value();
+        double diff = std::max(0.0, goals.minimum_winrate - this->cold->stats.win_rate);
+        double normalized_diff = diff / goals.minimum_winrate;
         win_rate_eval = win_rate_weight / std::exp(10 * normalized_diff);
     }
 
-    if (goals.expected_return_per_day.has_value())
+    if (is_set(goals.expected_return_per_day))
     {
         std::map<std::string, double> daily_returns = {};
         std::vector<Trade> closed_trades_copy = closed_trades;
@@ -610,7 +632,7 @@ void Trader::calculate_fitness()
             for (const auto &trade : closed_trades_copy)
             {
                 double trade_return = trade.pnl_percent;
-                std::string trade_date = time_t_to_string(trade.exit_date, "%Y-%m-%d");
+                std::string trade_date = time_t_to_string(to_time_t(trade.exit_date), "%Y-%m-%d");
                 if (trade_date == date)
                 {
                     daily_returns[date] *= 1 + trade_return;
@@ -632,14 +654,14 @@ void Trader::calculate_fitness()
         {
             for (const auto &daily_return : daily_returns)
             {
-                double diff = std::max(0.0, goals.expected_return_per_day.value() - daily_return.second);
-                double normalized_diff = diff / goals.expected_return_per_day.value();
+                double diff = std::max(0.0, goals.expected_return_per_day - daily_return.second);
+                double normalized_diff = diff / goals.expected_return_per_day;
                 expected_return_per_day_eval += expected_return_per_day_weight / (nb_days * std::exp(10 * normalized_diff));
             }
         }
     }
 
-    if (goals.expected_return_per_month.has_value())
+    if (is_set(goals.expected_return_per_month))
     {
         std::map<std::string, double> monthly_returns = {};
         std::vector<Trade> closed_trades_copy = closed_trades;
@@ -650,7 +672,7 @@ void Trader::calculate_fitness()
             for (const auto &trade : closed_trades_copy)
             {
                 double trade_return = trade.pnl_percent;
-                std::string trade_month = time_t_to_string(trade.exit_date, "%Y-%m");
+                std::string trade_month = time_t_to_string(to_time_t(trade.exit_date), "%Y-%m");
                 if (trade_month == month)
                 {
                     monthly_returns[month] *= 1 + trade_return;
@@ -672,17 +694,17 @@ void Trader::calculate_fitness()
         {
             for (const auto &monthly_return : monthly_returns)
             {
-                double diff = std::max(0.0, goals.expected_return_per_month.value() - monthly_return.second);
-                double normalized_diff = diff / goals.expected_return_per_month.value();
+                double diff = std::max(0.0, goals.expected_return_per_month - monthly_return.second);
+                double normalized_diff = diff / goals.expected_return_per_month;
                 expected_return_per_month_eval += expected_return_per_month_weight / (nb_months * std::exp(10 * normalized_diff));
             }
         }
     }
 
-    if (goals.expected_return.has_value())
+    if (is_set(goals.expected_return))
     {
-        double diff = std::max(0.0, goals.expected_return.value() - stats.performance);
-        double normalized_diff = diff / goals.expected_return.value();
+        double diff = std::max(0.0, goals.expected_return - this->cold->stats.performance);
+        double normalized_diff = diff / goals.expected_return;
         expected_return_eval = expected_return_weight / std::exp(10 * normalized_diff);
     }
 
@@ -691,7 +713,7 @@ void Trader::calculate_fitness()
     this->fitness = 0;
     double eval_coefficient = 0.0;
 
-    if (this->trades_history.empty())
+    if (this->cold->trades_history.empty())
     {
         this->fitness = 0;
         return;
@@ -700,7 +722,7 @@ void Trader::calculate_fitness()
     {
         this->fitness += maximum_nb_trades_eval;
         eval_coefficient += maximum_nb_trades_weight;
-        this->fitness_details["maximum_nb_trades_eval"] = std::to_string(maximum_nb_trades_eval) + "/" + std::to_string(maximum_nb_trades_weight);
+        this->cold->fitness_details.emplace_back("maximum_nb_trades_eval", std::to_string(maximum_nb_trades_eval) + "/" + std::to_string(maximum_nb_trades_weight));
 
         if (maximum_nb_trades_eval < 0 || maximum_nb_trades_eval > maximum_nb_trades_weight)
         {
@@ -708,11 +730,11 @@ void Trader::calculate_fitness()
             std::exit(1);
         }
     }
-    if (goals.minimum_nb_trades.has_value())
+    if (is_set(goals.minimum_nb_trades))
     {
         this->fitness += minimum_nb_trades_eval;
         eval_coefficient += minimum_nb_trades_weight;
-        this->fitness_details["minimum_nb_trades_eval"] = std::to_string(minimum_nb_trades_eval) + "/" + std::to_string(minimum_nb_trades_weight);
+        this->cold->fitness_details.emplace_back("minimum_nb_trades_eval", std::to_string(minimum_nb_trades_eval) + "/" + std::to_string(minimum_nb_trades_weight));
 
         if (minimum_nb_trades_eval < 0 || minimum_nb_trades_eval > minimum_nb_trades_weight)
         {
@@ -720,11 +742,11 @@ void Trader::calculate_fitness()
             std::exit(1);
         }
     }
-    if (goals.maximum_trade_duration.has_value())
+    if (is_set(goals.maximum_trade_duration))
     {
         this->fitness += max_trade_duration_eval;
         eval_coefficient += max_trade_duration_weight;
-        this->fitness_details["max_trade_duration_eval"] = std::to_string(max_trade_duration_eval) + "/" + std::to_string(max_trade_duration_weight);
+        this->cold->fitness_details.emplace_back("max_trade_duration_eval", std::to_string(max_trade_duration_eval) + "/" + std::to_string(max_trade_duration_weight));
 
         if (max_trade_duration_eval < 0 || max_trade_duration_eval > max_trade_duration_weight)
         {
@@ -732,11 +754,11 @@ void Trader::calculate_fitness()
             std::exit(1);
         }
     }
-    if (goals.maximum_drawdown.has_value())
+    if (is_set(goals.maximum_drawdown))
     {
         this->fitness += max_drawdown_eval;
         eval_coefficient += max_drawdown_weight;
-        this->fitness_details["max_drawdown_eval"] = std::to_string(max_drawdown_eval) + "/" + std::to_string(max_drawdown_weight);
+        this->cold->fitness_details.emplace_back("max_drawdown_eval", std::to_string(max_drawdown_eval) + "/" + std::to_string(max_drawdown_weight));
 
         if (max_drawdown_eval < 0 || max_drawdown_eval > max_drawdown_weight)
         {
@@ -744,11 +766,11 @@ void Trader::calculate_fitness()
             std::exit(1);
         }
     }
-    if (goals.minimum_profit_factor.has_value())
+    if (is_set(goals.minimum_profit_factor))
     {
         this->fitness += profit_factor_eval;
         eval_coefficient += profit_factor_weight;
-        this->fitness_details["profit_factor_eval"] = std::to_string(profit_factor_eval) + "/" + std::to_string(profit_factor_weight);
+        this->cold->fitness_details.emplace_back("profit_factor_eval", std::to_string(profit_factor_eval) + "/" + std::to_string(profit_factor_weight));
 
         if (profit_factor_eval < 0 || profit_factor_eval > profit_factor_weight)
         {
@@ -756,11 +778,11 @@ void Trader::calculate_fitness()
             std::exit(1);
         }
     }
-    if (goals.minimum_winrate.has_value())
+    if (is_set(goals.minimum_winrate))
     {
         this->fitness += win_rate_eval;
         eval_coefficient += win_rate_weight;
-        this->fitness_details["win_rate_eval"] = std::to_string(win_rate_eval) + "/" + std::to_string(win_rate_weight);
+        this->cold->fitness_details.emplace_back("win_rate_eval", std::to_string(win_rate_eval) + "/" + std::to_string(win_rate_weight));
 
         if (win_rate_eval < 0 || win_rate_eval > win_rate_weight)
         {
@@ -768,11 +790,11 @@ void Trader::calculate_fitness()
             std::exit(1);
         }
     }
-    if (goals.expected_return_per_day.has_value())
+    if (is_set(goals.expected_return_per_day))
     {
         this->fitness += expected_return_per_day_eval;
         eval_coefficient += expected_return_per_day_weight;
-        this->fitness_details["expected_return_per_day_eval"] = std::to_string(expected_return_per_day_eval) + "/" + std::to_string(expected_return_per_day_weight);
+        this->cold->fitness_details.emplace_back("expected_return_per_day_eval", std::to_string(expected_return_per_day_eval) + "/" + std::to_string(expected_return_per_day_weight));
 
         if (expected_return_per_day_eval < 0 || expected_return_per_day_eval > expected_return_per_day_weight)
         {
@@ -780,11 +802,11 @@ void Trader::calculate_fitness()
             std::exit(1);
         }
     }
-    if (goals.expected_return_per_month.has_value())
+    if (is_set(goals.expected_return_per_month))
     {
         this->fitness += expected_return_per_month_eval;
         eval_coefficient += expected_return_per_month_weight;
-        this->fitness_details["expected_return_per_month_eval"] = std::to_string(expected_return_per_month_eval) + "/" + std::to_string(expected_return_per_month_weight);
+        this->cold->fitness_details.emplace_back("expected_return_per_month_eval", std::to_string(expected_return_per_month_eval) + "/" + std::to_string(expected_return_per_month_weight));
 
         if (expected_return_per_month_eval < 0 || expected_return_per_month_eval > expected_return_per_month_weight)
         {
@@ -792,11 +814,11 @@ void Trader::calculate_fitness()
             std::exit(1);
         }
     }
-    if (goals.expected_return.has_value())
+    if (is_set(goals.expected_return))
     {
         this->fitness += expected_return_eval;
         eval_coefficient += expected_return_weight;
-        this->fitness_details["expected_return_eval"] = std::to_string(expected_return_eval) + "/" + std::to_string(expected_return_weight);
+        this->cold->fitness_details.emplace_back("expected_return_eval", std::to_string(expected_return_eval) + "/" + std::to_string(expected_return_weight));
 
         if (expected_return_eval < 0 || expected_return_eval > expected_return_eval)
         {
@@ -822,7 +844,7 @@ void Trader::calculate_fitness()
     // The purpose of this is to penalize the fitness of the trader if the strategy didn't cover all the days of the training period
 
     time_t first_day = string_to_time_t(all_dates.front());
-    time_t last_day = trades_history.back().entry_date;
+    time_t last_day = to_time_t(this->cold->trades_history.back().entry_date);
     int nb_days_covered = 0; // number of days the strategy covered by the trades
 
     // Count the number days between the first and the last day
@@ -853,7 +875,7 @@ void Trader::calculate_fitness()
 
     // Calculate the ratio of days the strategy covered by the trades
     double ratio_days_covered = static_cast<double>(nb_days_covered) / static_cast<double>(all_dates.size());
-    this->fitness_details["ratio_days_covered"] = std::to_string(decimal_floor(ratio_days_covered, 2));
+    this->cold->fitness_details.emplace_back("ratio_days_covered", std::to_string(decimal_floor(ratio_days_covered, 2)));
 
     // ***************** FINAL FITNESS ***************** //
 
@@ -866,7 +888,7 @@ void Trader::calculate_fitness()
  */
 void Trader::calculate_score()
 {
-    this->score = this->stats.total_net_profit;
+    this->score = this->cold->stats.total_net_profit;
 }
 
 /**
@@ -874,7 +896,7 @@ void Trader::calculate_score()
  */
 void Trader::calculate_stats()
 {
-    this->stats.calculate(this->trades_history, this->balance_history);
+    this->cold->stats.calculate(this->cold->trades_history, this->cold->balance_history);
 }
 
 /**
@@ -894,8 +916,8 @@ void Trader::open_position_by_market(double price, double size, OrderSide side)
 
     if (side == OrderSide::LONG)
     {
-        this->stats.total_trades++;
-        this->stats.total_long_trades++;
+        this->cold->stats.total_trades++;
+        this->cold->stats.total_long_trades++;
         this->balance -= fees;
         this->duration_in_position = 0;
         this->current_position = new Position{
@@ -905,12 +927,12 @@ void Trader::open_position_by_market(double price, double size, OrderSide side)
             .entry_date = this->current_date,
             .pnl = 0.0,
         };
-        this->trades_history.push_back(Trade{
-            .side = PositionSide::LONG,
-            .entry_date = this->current_position->entry_date,
+        this->cold->trades_history.push_back(Trade{
+            .entry_date = to_minute(this->current_position->entry_date),
             .entry_price = this->current_position->entry_price,
             .size = this->current_position->size,
             .fees = fees,
+            .side = PositionSide::LONG,
             .closed = false,
         });
 
@@ -921,8 +943,8 @@ void Trader::open_position_by_market(double price, double size, OrderSide side)
     }
     else if (side == OrderSide::SHORT)
     {
-        this->stats.total_trades++;
-        this->stats.total_short_trades++;
+        this->cold->stats.total_trades++;
+        this->cold->stats.total_short_trades++;
         this->balance -= fees;
         this->duration_in_position = 0;
         this->current_position = new Position{
@@ -932,12 +954,12 @@ void Trader::open_position_by_market(double price, double size, OrderSide side)
             .entry_date = this->current_date,
             .pnl = 0.0,
         };
-        this->trades_history.push_back(Trade{
-            .side = PositionSide::SHORT,
-            .entry_date = this->current_position->entry_date,
+        this->cold->trades_history.push_back(Trade{
+            .entry_date = to_minute(this->current_position->entry_date),
             .entry_price = this->current_position->entry_price,
             .size = this->current_position->size,
             .fees = fees,
+            .side = PositionSide::SHORT,
             .closed = false,
         });
 
@@ -971,14 +993,14 @@ void Trader::close_position_by_market(double price)
         // Calculate the fees
         double fees = calculate_commission(this->symbol_info.commission_per_lot, this->current_position->size, this->current_base_currency_conversion_rate);
 
-        this->trades_history.back().exit_date = this->current_date;
-        this->trades_history.back().exit_price = price;
-        this->trades_history.back().duration = duration_in_position;
-        this->trades_history.back().pnl = this->current_position->pnl;
-        this->trades_history.back().fees += fees;
-        this->trades_history.back().pnl_percent = this->current_position->pnl / (this->balance + fees);
-        this->trades_history.back().pnl_net_percent = (this->current_position->pnl - this->trades_history.back().fees) / (this->balance + fees);
-        this->trades_history.back().closed = true;
+        this->cold->trades_history.back().exit_date = to_minute(this->current_date);
+        this->cold->trades_history.back().exit_price = price;
+        this->cold->trades_history.back().duration = duration_in_position;
+        this->cold->trades_history.back().pnl = this->current_position->pnl;
+        this->cold->trades_history.back().fees += fees;
+        this->cold->trades_history.back().pnl_percent = this->current_position->pnl / (this->balance + fees);
+        this->cold->trades_history.back().pnl_net_percent = (this->current_position->pnl - this->cold->trades_history.back().fees) / (this->balance + fees);
+        this->cold->trades_history.back().closed = true;
 
         // Update the balance
         this->balance = std::max(0.0, this->balance + this->current_position->pnl - fees);
@@ -1015,14 +1037,14 @@ void Trader::close_position_by_limit(double price)
         // Calculate the fees
         double fees = calculate_commission(this->symbol_info.commission_per_lot, this->current_position->size, this->current_base_currency_conversion_rate);
 
-        this->trades_history.back().exit_date = this->current_date;
-        this->trades_history.back().exit_price = price;
-        this->trades_history.back().duration = duration_in_position;
-        this->trades_history.back().pnl = this->current_position->pnl;
-        this->trades_history.back().fees += fees;
-        this->trades_history.back().pnl_percent = this->current_position->pnl / (this->balance + fees);
-        this->trades_history.back().pnl_net_percent = (this->current_position->pnl - this->trades_history.back().fees) / (this->balance + fees);
-        this->trades_history.back().closed = true;
+        this->cold->trades_history.back().exit_date = to_minute(this->current_date);
+        this->cold->trades_history.back().exit_price = price;
+        this->cold->trades_history.back().duration = duration_in_position;
+        this->cold->trades_history.back().pnl = this->current_position->pnl;
+        this->cold->trades_history.back().fees += fees;
+        this->cold->trades_history.back().pnl_percent = this->current_position->pnl / (this->balance + fees);
+        this->cold->trades_history.back().pnl_net_percent = (this->current_position->pnl - this->cold->trades_history.back().fees) / (this->balance + fees);
+        this->cold->trades_history.back().closed = true;
 
         // Update the balance
         this->balance = std::max(0.0, this->balance + this->current_position->pnl - fees);
@@ -1070,8 +1092,8 @@ void Trader::check_open_orders()
 
     if (this->open_orders.size() > 0)
     {
-        std::vector<Order> long_orders = {};
-        std::vector<Order> short_orders = {};
+        OrderBuffer long_orders;
+        OrderBuffer short_orders;
 
         for (const auto &order : this->open_orders)
         {
@@ -1214,7 +1236,7 @@ void Trader::update_trailing_stop_loss()
 
     if (config.type == TypeTrailingStopLoss::PERCENT)
     {
-        if (!config.trailing_stop_loss_in_percent.has_value())
+        if (!is_set(config.trailing_stop_loss_in_percent))
         {
             std::cerr << "The trailing stop loss in percent is not set." << std::endl;
             return;
@@ -1223,15 +1245,15 @@ void Trader::update_trailing_stop_loss()
         if (this->current_position->side == PositionSide::LONG)
         {
             // Check if the activation level is reached
-            if (config.activation_level_in_percent.has_value())
+            if (is_set(config.activation_level_in_percent))
             {
-                if (current_price < this->current_position->entry_price + (this->current_position->entry_price * config.activation_level_in_percent.value()))
+                if (current_price < this->current_position->entry_price + (this->current_position->entry_price * config.activation_level_in_percent))
                 {
                     return;
                 }
             }
 
-            double trailing_stop_loss = current_price - (current_price * config.trailing_stop_loss_in_percent.value());
+            double trailing_stop_loss = current_price - (current_price * config.trailing_stop_loss_in_percent);
             if (trailing_stop_loss > stop_loss_order->price)
             {
                 stop_loss_order->price = trailing_stop_loss;
@@ -1240,15 +1262,15 @@ void Trader::update_trailing_stop_loss()
         else if (this->current_position->side == PositionSide::SHORT)
         {
             // Check if the activation level is reached
-            if (config.activation_level_in_percent.has_value())
+            if (is_set(config.activation_level_in_percent))
             {
-                if (current_price > this->current_position->entry_price - (this->current_position->entry_price * config.activation_level_in_percent.value()))
+                if (current_price > this->current_position->entry_price - (this->current_position->entry_price * config.activation_level_in_percent))
                 {
                     return;
                 }
             }
 
-            double trailing_stop_loss = current_price + (current_price * config.trailing_stop_loss_in_percent.value());
+            double trailing_stop_loss = current_price + (current_price * config.trailing_stop_loss_in_percent);
             if (trailing_stop_loss < stop_loss_order->price)
             {
                 stop_loss_order->price = trailing_stop_loss;
@@ -1257,7 +1279,7 @@ void Trader::update_trailing_stop_loss()
     }
     else if (config.type == TypeTrailingStopLoss::POINTS)
     {
-        if (!config.trailing_stop_loss_in_points.has_value())
+        if (!is_set(config.trailing_stop_loss_in_points))
         {
             std::cerr << "The trailing stop loss in points is not set." << std::endl;
             return;
@@ -1266,15 +1288,15 @@ void Trader::update_trailing_stop_loss()
         if (this->current_position->side == PositionSide::LONG)
         {
             // Check if the activation level is reached
-            if (config.activation_level_in_points.has_value())
+            if (is_set(config.activation_level_in_points))
             {
-                if (current_price < this->current_position->entry_price + config.activation_level_in_points.value() * symbol_info.point_value)
+                if (current_price < this->current_position->entry_price + config.activation_level_in_points * symbol_info.point_value)
                 {
                     return;
                 }
             }
 
-            double trailing_stop_loss = current_price - config.trailing_stop_loss_in_points.value() * symbol_info.point_value;
+            double trailing_stop_loss = current_price - config.trailing_stop_loss_in_points * symbol_info.point_value;
             if (trailing_stop_loss > stop_loss_order->price)
             {
                 stop_loss_order->price = trailing_stop_loss;
@@ -1283,15 +1305,15 @@ void Trader::update_trailing_stop_loss()
         else if (this->current_position->side == PositionSide::SHORT)
         {
             // Check if the activation level is reached
-            if (config.activation_level_in_points.has_value())
+            if (is_set(config.activation_level_in_points))
             {
-                if (current_price > this->current_position->entry_price - config.activation_level_in_points.value() * symbol_info.point_value)
+                if (current_price > this->current_position->entry_price - config.activation_level_in_points * symbol_info.point_value)
                 {
                     return;
                 }
             }
 
-            double trailing_stop_loss = current_price + config.trailing_stop_loss_in_points.value() * symbol_info.point_value;
+            double trailing_stop_loss = current_price + config.trailing_stop_loss_in_points * symbol_info.point_value;
             if (trailing_stop_loss < stop_loss_order->price)
             {
                 stop_loss_order->price = trailing_stop_loss;
@@ -1305,7 +1327,7 @@ void Trader::update_trailing_stop_loss()
  */
 void Trader::print_stats_to_console()
 {
-    this->stats.print();
+    this->cold->stats.print();
 }
 
 /**
@@ -1314,9 +1336,9 @@ void Trader::print_stats_to_console()
 void Trader::print_fitness_details_to_console()
 {
     std::string details = std::string("🔎 Fitness details: ");
-    for (const auto &[key, value] : this->fitness_details)
+    for (const auto &[key, value] : this->cold->fitness_details)
     {
-        details += key + "=" + value + ", ";
+        details += std::string(key) + "=" + value + ", ";
     }
     std::cout << details << std::endl;
 }
@@ -1336,20 +1358,20 @@ nlohmann::json Trader::to_json() const
     json["genome"] = this->genome->to_json();
 
     // Stats
-    json["stats"] = this->stats.to_json();
+    json["stats"] = this->cold->stats.to_json();
 
     // Balance history
-    json["balance_history"] = this->balance_history;
+    json["balance_history"] = this->cold->balance_history;
 
     // Trades history
     nlohmann::json trades_history_json = {};
-    for (const auto &trade : this->trades_history)
+    for (const auto &trade : this->cold->trades_history)
     {
         trades_history_json.push_back({
             {"side", trade.side},
-            {"entry_date", trade.entry_date},
+            {"entry_date", to_time_t(trade.entry_date)},
             {"entry_price", trade.entry_price},
-            {"exit_date", trade.exit_date},
+            {"exit_date", to_time_t(trade.exit_date)},
             {"exit_price", trade.exit_price},
             {"size", trade.size},
             {"pnl", trade.pnl},
@@ -1386,27 +1408,27 @@ Trader *Trader::from_json(nlohmann::json &json, Config &config, Logger *logger)
     trader->fitness = json.at("fitness").get<double>();
     trader->score = json.at("score").get<double>();
     trader->generation = json.at("generation").get<int>();
-    trader->stats = Stats::from_json(json.at("stats"));
-    trader->balance_history = json.at("balance_history").get<std::vector<double>>();
+    trader->cold->stats = Stats::from_json(json.at("stats"));
+    trader->cold->balance_history = json.at("balance_history").get<std::vector<double>>();
 
-    trader->trades_history = {};
+    trader->cold->trades_history = {};
     for (const auto &trade_json : json.at("trades_history"))
     {
         Trade trade = {
-            .side = trade_json.at("side").get<PositionSide>(),
-            .entry_date = trade_json.at("entry_date").get<time_t>(),
+            .entry_date = to_minute(trade_json.at("entry_date").get<time_t>()),
+            .exit_date = to_minute(trade_json.at("exit_date").get<time_t>()),
             .entry_price = trade_json.at("entry_price").get<double>(),
-            .exit_date = trade_json.at("exit_date").get<time_t>(),
             .exit_price = trade_json.at("exit_price").get<double>(),
             .size = trade_json.at("size").get<double>(),
             .pnl = trade_json.at("pnl").get<double>(),
-            .fees = trade_json.at("fees").get<double>(),
             .pnl_percent = trade_json.at("pnl_percent").get<double>(),
             .pnl_net_percent = trade_json.at("pnl_net_percent").get<double>(),
+            .fees = trade_json.at("fees").get<double>(),
             .duration = trade_json.at("duration").get<int>(),
+            .side = trade_json.at("side").get<PositionSide>(),
             .closed = trade_json.at("closed").get<bool>(),
         };
-        trader->trades_history.push_back(trade);
+        trader->cold->trades_history.push_back(trade);
     }
 
     return trader;
@@ -1418,7 +1440,7 @@ Trader *Trader::from_json(nlohmann::json &json, Config &config, Logger *logger)
  */
 void Trader::generate_balance_history_graph(const std::string &filename)
 {
-    if (this->balance_history.empty())
+    if (this->cold->balance_history.empty())
     {
         std::cerr << "No balance history to generate a graph." << std::endl;
         return;
@@ -1443,9 +1465,9 @@ void Trader::generate_balance_history_graph(const std::string &filename)
 
     // Generate data for the sine wave
     std::vector<std::pair<double, double>> data;
-    for (int i = 0; i < this->balance_history.size(); ++i)
+    for (int i = 0; i < this->cold->balance_history.size(); ++i)
     {
-        data.push_back(std::make_pair(i, this->balance_history[i]));
+        data.push_back(std::make_pair(i, this->cold->balance_history[i]));
     }
 
     // Specify terminal type and output file
@@ -1476,7 +1498,7 @@ void Trader::generate_report(const std::string &filename, time_t start_date, tim
 {
     // Select only closed trade
     std::vector<Trade> closed_trades = {};
-    for (const auto &trade : this->trades_history)
+    for (const auto &trade : this->cold->trades_history)
     {
         if (trade.closed)
         {
@@ -1607,57 +1629,57 @@ void Trader::generate_report(const std::string &filename, time_t start_date, tim
                 <tr>
                     <td><b>Initial balance:</b></td>
                     <td>)"
-        << this->stats.initial_balance << R"(</td>
+        << this->cold->stats.initial_balance << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Final balance:</b></td>
                     <td>)"
-        << this->stats.final_balance << R"(</td>
+        << this->cold->stats.final_balance << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Performance:</b></td>
                     <td>)"
-        << decimal_floor(this->stats.performance * 100, 2) << "%" << R"(</td>
+        << decimal_floor(this->cold->stats.performance * 100, 2) << "%" << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Sharpe ratio:</b></td>
                     <td>)"
-        << decimal_floor(this->stats.sharpe_ratio, 2) << R"(</td>
+        << decimal_floor(this->cold->stats.sharpe_ratio, 2) << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Sortino ratio:</b></td>
                     <td>)"
-        << decimal_floor(this->stats.sortino_ratio, 2) << R"(</td>
+        << decimal_floor(this->cold->stats.sortino_ratio, 2) << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Total net profit:</b></td>
                     <td>)"
-        << this->stats.total_net_profit << R"(</td>
+        << this->cold->stats.total_net_profit << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Total profit:</b></td>
                     <td>)"
-        << this->stats.total_profit << R"(</td>
+        << this->cold->stats.total_profit << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Total loss:</b></td>
                     <td>)"
-        << this->stats.total_loss << R"(</td>
+        << this->cold->stats.total_loss << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Total fees:</b></td>
                     <td>)"
-        << this->stats.total_fees << R"(</td>
+        << this->cold->stats.total_fees << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Profit factor:</b></td>
                     <td>)"
-        << decimal_floor(this->stats.profit_factor, 2) << R"(</td>
+        << decimal_floor(this->cold->stats.profit_factor, 2) << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Max drawdown:</b></td>
                     <td>)"
-        << -decimal_floor(this->stats.max_drawdown * 100, 2) << "%" << R"(</td>
+        << -decimal_floor(this->cold->stats.max_drawdown * 100, 2) << "%" << R"(</td>
                 </tr>
             </table>
         </div>
@@ -1666,57 +1688,57 @@ void Trader::generate_report(const std::string &filename, time_t start_date, tim
                 <tr>
                     <td><b>Total trades:</b></td>
                     <td>)"
-        << this->stats.total_trades << R"(</td>
+        << this->cold->stats.total_trades << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Total win rate:</b></td>
                     <td>)"
-        << decimal_floor(this->stats.win_rate * 100, 2) << "%" << " (" << this->stats.total_winning_trades << "/" << this->stats.total_trades << ")" << R"(</td>
+        << decimal_floor(this->cold->stats.win_rate * 100, 2) << "%" << " (" << this->cold->stats.total_winning_trades << "/" << this->cold->stats.total_trades << ")" << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Long win rate:</b></td>
                     <td>)"
-        << decimal_floor(this->stats.long_win_rate * 100, 2) << "%" << " (" << this->stats.total_winning_long_trades << "/" << this->stats.total_long_trades << ")" << R"(</td>
+        << decimal_floor(this->cold->stats.long_win_rate * 100, 2) << "%" << " (" << this->cold->stats.total_winning_long_trades << "/" << this->cold->stats.total_long_trades << ")" << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Short win rate:</b></td>
                     <td>)"
-        << decimal_floor(this->stats.short_win_rate * 100, 2) << "%" << " (" << this->stats.total_winning_short_trades << "/" << this->stats.total_short_trades << ")" << R"(</td>
+        << decimal_floor(this->cold->stats.short_win_rate * 100, 2) << "%" << " (" << this->cold->stats.total_winning_short_trades << "/" << this->cold->stats.total_short_trades << ")" << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Max profit:</b></td>
                     <td>)"
-        << this->stats.max_profit << R"(</td>
+        << this->cold->stats.max_profit << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Max loss:</b></td>
                     <td>)"
-        << this->stats.max_loss << R"(</td>
+        << this->cold->stats.max_loss << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Max consecutive profit:</b></td>
                     <td>)"
-        << this->stats.max_consecutive_profit << R"(</td>
+        << this->cold->stats.max_consecutive_profit << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Max consecutive loss:</b></td>
                     <td>)"
-        << this->stats.max_consecutive_loss << R"(</td>
+        << this->cold->stats.max_consecutive_loss << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Max consecutive winning trades:</b></td>
                     <td>)"
-        << this->stats.max_consecutive_winning_trades << R"(</td>
+        << this->cold->stats.max_consecutive_winning_trades << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Max consecutive losing trades:</b></td>
                     <td>)"
-        << this->stats.max_consecutive_losing_trades << R"(</td>
+        << this->cold->stats.max_consecutive_losing_trades << R"(</td>
                 </tr>
                 <tr>
                     <td><b>Average trade duration:</b></td>
                     <td>)"
-        << decimal_floor(this->stats.average_trade_duration, 2) << " candles" << R"(</td>
+        << decimal_floor(this->cold->stats.average_trade_duration, 2) << " candles" << R"(</td>
                 </tr>
             </table>
         </div>
@@ -1745,10 +1767,10 @@ void Trader::generate_report(const std::string &filename, time_t start_date, tim
           <tbody>)";
 
     // Write the trades history to the file
-    double balance = this->stats.initial_balance;
-    for (int i = 0; i < this->trades_history.size(); ++i)
+    double balance = this->cold->stats.initial_balance;
+    for (int i = 0; i < this->cold->trades_history.size(); ++i)
     {
-        Trade trade = this->trades_history[i];
+        Trade trade = this->cold->trades_history[i];
         balance += trade.pnl - trade.fees;
 
         file << R"(
@@ -1756,9 +1778,9 @@ void Trader::generate_report(const std::string &filename, time_t start_date, tim
             <td>)"
              << i << R"(</td>
             <td>)"
-             << time_t_to_string(trade.entry_date) << R"(</td>
+             << time_t_to_string(to_time_t(trade.entry_date)) << R"(</td>
             <td>)"
-             << time_t_to_string(trade.exit_date) << R"(</td>
+             << time_t_to_string(to_time_t(trade.exit_date)) << R"(</td>
             <td>)"
              << this->config.general.symbol << R"(</td>
             <td style=)"
@@ -1786,7 +1808,7 @@ void Trader::generate_report(const std::string &filename, time_t start_date, tim
     std::string monthly_returns_labels = "";
     std::string monthly_returns_data = "";
 
-    balance = this->stats.initial_balance;
+    balance = this->cold->stats.initial_balance;
     balance_history_labels += "\"" + time_t_to_string(start_date) + "\",";
     balance_history_data += std::to_string(balance) + ",";
 
@@ -1794,12 +1816,12 @@ void Trader::generate_report(const std::string &filename, time_t start_date, tim
     for (const auto &trade : closed_trades)
     {
         balance += trade.pnl - trade.fees;
-        balance_history_labels += "\"" + time_t_to_string(trade.exit_date) + "\",";
+        balance_history_labels += "\"" + time_t_to_string(to_time_t(trade.exit_date)) + "\",";
         balance_history_data += std::to_string(balance) + ",";
     }
 
     // Create the data for the monthly returns bar chart
-    for (const auto &[monthly_returns_data_key, monthly_returns_data_value] : this->stats.monthly_returns)
+    for (const auto &[monthly_returns_data_key, monthly_returns_data_value] : this->cold->stats.monthly_returns)
     {
         monthly_returns_labels += "\"" + monthly_returns_data_key + "\",";
         monthly_returns_data += std::to_string(monthly_returns_data_value * 100) + ",";
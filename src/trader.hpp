@@ -2,7 +2,9 @@
 #define TRADER_HPP
 
 #include <ctime>
+#include <memory>
 #include <vector>
+#include <utility>
 #include <unordered_map>
 #include "libs/json.hpp"
 #include "neat/genome.hpp"
@@ -10,6 +12,43 @@
 #include "trading/stats.hpp"
 #include "types.hpp"
 
+/**
+ * @brief Cold state of a trader.
+ *
+ * These fields are only read when a trader is evaluated or reported, not in
+ * the per-candle update loop. Keeping them behind a pointer shrinks the
+ * Trader object itself, so the genome-evaluation loop over many traders
+ * touches fewer cache lines per trader.
+ */
+struct TraderCold
+{
+    // History
+    std::vector<double> balance_history;
+    std::vector<Trade> trades_history;
+
+    // Statistics of the trader
+    Stats stats;
+
+    // Fitness evaluation details. A handful of fixed keys is written per
+    // evaluation, so a flat vector of literal-key pairs avoids the hashing
+    // and node allocations of a map and keeps the report order stable.
+    std::vector<std::pair<const char *, std::string>> fitness_details;
+};
+
+/**
+ * @brief Pre-resolved indicator input feeding the genome vision.
+ *
+ * The indicator set is frozen once the config is parsed, so the time frame
+ * and the hash keys of every input are resolved when the trader is built
+ * instead of rebuilding the reverse key string on each look call.
+ */
+struct NetworkInput
+{
+    TimeFrame time_frame;   // Time frame holding the indicator values
+    std::string id;         // Key of the indicator values
+    std::string reverse_id; // Key of the reversed indicator values
+};
+
 class Trader
 {
 public:
@@ -21,14 +60,10 @@ public:
     double current_base_currency_conversion_rate;
     time_t current_date;
 
-    // History
-    std::vector<double> balance_history;
-    std::vector<Trade> trades_history;
-
     // Trading stuffs
     double balance;
     Position *current_position;
-    std::vector<Order> open_orders;
+    OrderBuffer open_orders;
     int duration_in_position;   // Duration in the current position
     int duration_without_trade; // Countdown to avoid trading too much
     int nb_trades_today;        // Number of trades today
@@ -43,11 +78,12 @@ public:
     int lifespan;
     bool dead;
 
-    // Statistics of the trader
-    Stats stats;
+    // Network inputs resolved once at construction
+    std::vector<NetworkInput> network_inputs;
+    bool include_reverse_inputs; // Whether the reversed values feed the vision too
 
-    // Fitness evaluation details
-    std::unordered_map<std::string, std::string> fitness_details;
+    // Cold state (histories, statistics, fitness details)
+    std::unique_ptr<TraderCold> cold;
 
     // Logger
     Logger *logger;
@@ -71,7 +107,7 @@ public:
      * @param base_currency_conversion_rate Conversion rate when the base asset traded is different from the account currency.
      * @param position_infos Vector of position information.
      */
-    void look(IndicatorsData &indicators, double base_currency_conversion_rate, std::vector<PositionInfo> position_infos);
+    void look(const IndicatorsData &indicators, double base_currency_conversion_rate, const std::vector<PositionInfo> &position_infos);
 
     /**
      * @brief Get the outputs from the neural network.
@@ -94,7 +130,7 @@ public:
      *
      * @param candles Candle data for all time frames.
      */
-    void update(CandlesData &candles);
+    void update(const CandlesData &candles);
 
     /**
      * @brief Check if the trader can trade.
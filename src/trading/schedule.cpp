@@ -14,9 +14,9 @@
  * @param trading_schedule The trading schedule for each day of the week.
  * @return The schedule for the given day.
  */
-std::vector<bool> get_day_schedule(const int day, const TradingSchedule &trading_schedule)
+DaySchedule get_day_schedule(const int day, const TradingSchedule &trading_schedule)
 {
-    std::vector<bool> day_schedule;
+    DaySchedule day_schedule;
     switch (day)
     {
     case 0:
@@ -59,8 +59,7 @@ bool is_on_trading_schedule(const time_t date, const TradingSchedule &trading_sc
 {
     std::tm date_tm = time_t_to_tm(date);
     int day = date_tm.tm_wday;
-    std::vector<bool> day_schedule = get_day_schedule(day, trading_schedule);
-    return day_schedule[date_tm.tm_hour];
+    return get_day_schedule(day, trading_schedule)[date_tm.tm_hour];
 }
 
 /**
@@ -70,14 +69,5 @@ bool is_on_trading_schedule(const time_t date, const TradingSchedule &trading_sc
  */
 bool has_session_for_day(const int day, const TradingSchedule &trading_schedule)
 {
-    std::vector<bool> day_schedule = get_day_schedule(day, trading_schedule);
-
-    for (int i = 0; i < 24; i++)
-    {
-        if (day_schedule[i])
-        {
-            return true;
-        }
-    }
-    return false;
+    return get_day_schedule(day, trading_schedule).any();
 }
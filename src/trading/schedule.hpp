@@ -12,7 +12,7 @@
  * @param trading_schedule The trading schedule for each day of the week.
  * @return The schedule for the given day.
  */
-std::vector<bool> get_day_schedule(const int day, const TradingSchedule &trading_schedule);
+DaySchedule get_day_schedule(const int day, const TradingSchedule &trading_schedule);
 
 /**
  * @brief Check if the given date and time are within the specified trading schedule.
@@ -537,7 +537,7 @@ void Stats::calculate_monthly_returns(const std::vector<Trade> &closed_trades)
     for (const auto &trade : closed_trades)
     {
         double trade_return = trade.pnl_net_percent;
-        std::string date_key = time_t_to_string(trade.exit_date, "%Y-%m");
+        std::string date_key = time_t_to_string(to_time_t(trade.exit_date), "%Y-%m");
         if (this->monthly_returns.find(date_key) == this->monthly_returns.end())
         {
             this->monthly_returns[date_key] = 1.0;
@@ -36,14 +36,14 @@ TEST_F(StatsTest, Performance)
 TEST_F(StatsTest, TotalTradesStats)
 {
     this->trades_history = {
-        Trade{.side = PositionSide::LONG, .pnl = 100, .closed = true},
-        Trade{.side = PositionSide::LONG, .pnl = -50, .closed = true},
-        Trade{.side = PositionSide::LONG, .pnl = -50, .closed = true},
-        Trade{.side = PositionSide::LONG, .pnl = 100, .closed = true},
-        Trade{.side = PositionSide::SHORT, .pnl = -50, .closed = true},
-        Trade{.side = PositionSide::SHORT, .pnl = -50, .closed = true},
-        Trade{.side = PositionSide::SHORT, .pnl = 50, .closed = true},
-        Trade{.side = PositionSide::SHORT, .pnl = 50, .closed = true},
+        Trade{.pnl = 100, .side = PositionSide::LONG, .closed = true},
+        Trade{.pnl = -50, .side = PositionSide::LONG, .closed = true},
+        Trade{.pnl = -50, .side = PositionSide::LONG, .closed = true},
+        Trade{.pnl = 100, .side = PositionSide::LONG, .closed = true},
+        Trade{.pnl = -50, .side = PositionSide::SHORT, .closed = true},
+        Trade{.pnl = -50, .side = PositionSide::SHORT, .closed = true},
+        Trade{.pnl = 50, .side = PositionSide::SHORT, .closed = true},
+        Trade{.pnl = 50, .side = PositionSide::SHORT, .closed = true},
     };
 
     stats.calculate(this->trades_history, this->balance_history);
@@ -83,14 +83,14 @@ TEST_F(StatsTest, MaxDrawdown)
 TEST_F(StatsTest, WinrateStats)
 {
     this->trades_history = {
-        {.side = PositionSide::LONG, .pnl = 100, .closed = true},
-        {.side = PositionSide::SHORT, .pnl = -50, .closed = true},
-        {.side = PositionSide::LONG, .pnl = -50, .closed = true},
-        {.side = PositionSide::SHORT, .pnl = 100, .closed = true},
-        {.side = PositionSide::LONG, .pnl = -50, .closed = true},
-        {.side = PositionSide::SHORT, .pnl = -50, .closed = true},
-        {.side = PositionSide::LONG, .pnl = 50, .closed = true},
-        {.side = PositionSide::SHORT, .pnl = 50, .closed = true},
+        {.pnl = 100, .side = PositionSide::LONG, .closed = true},
+        {.pnl = -50, .side = PositionSide::SHORT, .closed = true},
+        {.pnl = -50, .side = PositionSide::LONG, .closed = true},
+        {.pnl = 100, .side = PositionSide::SHORT, .closed = true},
+        {.pnl = -50, .side = PositionSide::LONG, .closed = true},
+        {.pnl = -50, .side = PositionSide::SHORT, .closed = true},
+        {.pnl = 50, .side = PositionSide::LONG, .closed = true},
+        {.pnl = 50, .side = PositionSide::SHORT, .closed = true},
     };
 
     stats.calculate(this->trades_history, this->balance_history);
@@ -191,11 +191,11 @@ TEST_F(StatsTest, MaximumConsecutiveProfitLossStats)
 TEST_F(StatsTest, AverageTradeDuration)
 {
     this->trades_history = {
-        {.closed = true, .duration = 1},
-        {.closed = true, .duration = 2},
-        {.closed = true, .duration = 3},
-        {.closed = true, .duration = 4},
-        {.closed = true, .duration = 5},
+        {.duration = 1, .closed = true},
+        {.duration = 2, .closed = true},
+        {.duration = 3, .closed = true},
+        {.duration = 4, .closed = true},
+        {.duration = 5, .closed = true},
     };
 
     stats.calculate(this->trades_history, this->balance_history);
@@ -231,10 +231,10 @@ TEST_F(StatsTest, MonthlyReturns)
     };
 
     this->trades_history = {
-        {.pnl_net_percent = 0.2, .closed = true, .exit_date = std::mktime(&first_month)},
-        {.pnl_net_percent = 0.5, .closed = true, .exit_date = std::mktime(&first_month)},
-        {.pnl_net_percent = -0.1, .closed = true, .exit_date = std::mktime(&second_month)},
-        {.pnl_net_percent = 0.0, .closed = true, .exit_date = std::mktime(&third_month)},
+        {.exit_date = to_minute(std::mktime(&first_month)), .pnl_net_percent = 0.2, .closed = true},
+        {.exit_date = to_minute(std::mktime(&first_month)), .pnl_net_percent = 0.5, .closed = true},
+        {.exit_date = to_minute(std::mktime(&second_month)), .pnl_net_percent = -0.1, .closed = true},
+        {.exit_date = to_minute(std::mktime(&third_month)), .pnl_net_percent = 0.0, .closed = true},
     };
 
     stats.calculate(this->trades_history, this->balance_history);
@@ -274,10 +274,10 @@ TEST_F(StatsTest, SharpeRatio)
     };
 
     this->trades_history = {
-        {.pnl_net_percent = 0.2, .closed = true, .exit_date = std::mktime(&first_month)},
-        {.pnl_net_percent = 0.5, .closed = true, .exit_date = std::mktime(&first_month)},
-        {.pnl_net_percent = -0.1, .closed = true, .exit_date = std::mktime(&second_month)},
-        {.pnl_net_percent = 0.3, .closed = true, .exit_date = std::mktime(&third_month)},
+        {.exit_date = to_minute(std::mktime(&first_month)), .pnl_net_percent = 0.2, .closed = true},
+        {.exit_date = to_minute(std::mktime(&first_month)), .pnl_net_percent = 0.5, .closed = true},
+        {.exit_date = to_minute(std::mktime(&second_month)), .pnl_net_percent = -0.1, .closed = true},
+        {.exit_date = to_minute(std::mktime(&third_month)), .pnl_net_percent = 0.3, .closed = true},
     };
 
     stats.calculate(this->trades_history, this->balance_history);
@@ -313,10 +313,10 @@ TEST_F(StatsTest, SortinoRatio)
     };
 
     this->trades_history = {
-        {.pnl_net_percent = -0.2, .closed = true, .exit_date = std::mktime(&first_month)},
-        {.pnl_net_percent = 0.1, .closed = true, .exit_date = std::mktime(&first_month)},
-        {.pnl_net_percent = -0.15, .closed = true, .exit_date = std::mktime(&second_month)},
-        {.pnl_net_percent = 0.5, .closed = true, .exit_date = std::mktime(&third_month)},
+        {.exit_date = to_minute(std::mktime(&first_month)), .pnl_net_percent = -0.2, .closed = true},
+        {.exit_date = to_minute(std::mktime(&first_month)), .pnl_net_percent = 0.1, .closed = true},
+        {.exit_date = to_minute(std::mktime(&second_month)), .pnl_net_percent = -0.15, .closed = true},
+        {.exit_date = to_minute(std::mktime(&third_month)), .pnl_net_percent = 0.5, .closed = true},
     };
 
     stats.calculate(this->trades_history, this->balance_history);
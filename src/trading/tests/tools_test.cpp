@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "../tools.hpp"
 #include "../../types.hpp"
+#include "../../utils/string_arena.hpp"
 
 // Test fixture for trading tools
 class TradingToolsTest : public ::testing::Test
@@ -12,8 +13,8 @@ protected:
     void SetUp() override
     {
         // Initialize any necessary objects or variables
-        symbol_infos.asset = "EUR";
-        symbol_infos.base = "USD";
+        symbol_infos.asset = intern_string("EUR");
+        symbol_infos.base = intern_string("USD");
         symbol_infos.decimal_places = 5;
         symbol_infos.point_value = 0.0001;
         symbol_infos.contract_size = 100000;
@@ -21,7 +22,7 @@ protected:
         symbol_infos.max_lot_size = 10;
         symbol_infos.lot_size_step = 0.01;
         symbol_infos.commission_per_lot = 2.0;
-        symbol_infos.commission_base = "EUR";
+        symbol_infos.commission_base = intern_string("EUR");
 
         base_currency_conversion_rate = 1.0;
     }
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+#include "../trade_pool.hpp"
+#include "../../types.hpp"
+
+TEST(TradePoolTest, AcquireAndRelease)
+{
+    TradePool pool;
+
+    // A fresh vector comes out empty with the hinted capacity
+    std::vector<Trade> trades = pool.acquire(16);
+    ASSERT_TRUE(trades.empty());
+    ASSERT_GE(trades.capacity(), 16);
+
+    // Grow it, release it and acquire again: the capacity is reused
+    for (int i = 0; i < 100; ++i)
+    {
+        trades.push_back(Trade{});
+    }
+    size_t grown_capacity = trades.capacity();
+    pool.release(std::move(trades));
+
+    std::vector<Trade> recycled = pool.acquire();
+    ASSERT_TRUE(recycled.empty());
+    ASSERT_EQ(recycled.capacity(), grown_capacity);
+}
+
+TEST(TradePoolTest, GlobalPool)
+{
+    std::vector<Trade> trades = global_trade_pool().acquire();
+    ASSERT_TRUE(trades.empty());
+    global_trade_pool().release(std::move(trades));
+}
@@ -108,7 +108,7 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
     double tp_price = 0.0, sl_price = 0.0;
     if (config.type_take_profit == TypeTakeProfitStopLoss::POINTS)
     {
-        if (!config.take_profit_in_points.has_value())
+        if (!is_set(config.take_profit_in_points))
         {
             throw std::invalid_argument("Take profit in points is not set.");
             std::exit(1);
@@ -116,16 +116,16 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
 
         if (side == PositionSide::LONG)
         {
-            tp_price = market_price + config.take_profit_in_points.value() * symbol_info.point_value;
+            tp_price = market_price + config.take_profit_in_points * symbol_info.point_value;
         }
         else
         {
-            tp_price = market_price - config.take_profit_in_points.value() * symbol_info.point_value;
+            tp_price = market_price - config.take_profit_in_points * symbol_info.point_value;
         }
     }
     else if (config.type_take_profit == TypeTakeProfitStopLoss::PERCENT)
     {
-        if (!config.take_profit_in_percent.has_value())
+        if (!is_set(config.take_profit_in_percent))
         {
             throw std::invalid_argument("Take profit in percent is not set.");
             std::exit(1);
@@ -133,16 +133,16 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
 
         if (side == PositionSide::LONG)
         {
-            tp_price = decimal_floor(market_price + market_price * config.take_profit_in_percent.value(), symbol_info.decimal_places);
+            tp_price = decimal_floor(market_price + market_price * config.take_profit_in_percent, symbol_info.decimal_places);
         }
         else
         {
-            tp_price = decimal_ceil(market_price - market_price * config.take_profit_in_percent.value(), symbol_info.decimal_places);
+            tp_price = decimal_ceil(market_price - market_price * config.take_profit_in_percent, symbol_info.decimal_places);
         }
     }
     else if (config.type_take_profit == TypeTakeProfitStopLoss::EXTREMUM)
     {
-        if (!config.take_profit_extremum_period.has_value())
+        if (!is_set(config.take_profit_extremum_period))
         {
             throw std::invalid_argument("Take profit extremum period is not set.");
             std::exit(1);
@@ -151,7 +151,7 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
         if (side == PositionSide::LONG)
         {
             double highest_high = 0.0;
-            for (int i = candles.size() - config.take_profit_extremum_period.value(); i < candles.size(); i++)
+            for (int i = candles.size() - config.take_profit_extremum_period; i < candles.size(); i++)
             {
                 if (candles[i].high > highest_high)
                 {
@@ -163,7 +163,7 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
         else
         {
             double lowest_low = candles[0].low;
-            for (int i = 0; i < config.take_profit_extremum_period.value(); i++)
+            for (int i = 0; i < config.take_profit_extremum_period; i++)
             {
                 if (candles[i].low < lowest_low)
                 {
@@ -175,32 +175,32 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
     }
     else if (config.type_take_profit == TypeTakeProfitStopLoss::ATR)
     {
-        if (!config.take_profit_atr_period.has_value())
+        if (!is_set(config.take_profit_atr_period))
         {
             config.take_profit_atr_period = 14; // Default value
         }
 
-        if (config.take_profit_atr_multiplier.has_value())
+        if (is_set(config.take_profit_atr_multiplier))
         {
             config.take_profit_atr_multiplier = 1.0; // Default value
         }
 
-        ATR atr_indicator = ATR(config.take_profit_atr_period.value());
+        ATR atr_indicator = ATR(config.take_profit_atr_period);
         std::vector<double> atr_values = atr_indicator.calculate(candles, false);
         double atr = atr_values[atr_values.size() - 1];
         if (side == PositionSide::LONG)
         {
-            tp_price = market_price + atr * config.take_profit_atr_multiplier.value();
+            tp_price = market_price + atr * config.take_profit_atr_multiplier;
         }
         else
         {
-            tp_price = market_price - atr * config.take_profit_atr_multiplier.value();
+            tp_price = market_price - atr * config.take_profit_atr_multiplier;
         }
     }
 
     if (config.type_stop_loss == TypeTakeProfitStopLoss::POINTS)
     {
-        if (!config.stop_loss_in_points.has_value())
+        if (!is_set(config.stop_loss_in_points))
         {
             throw std::invalid_argument("Stop loss in points is not set.");
             std::exit(1);
@@ -208,16 +208,16 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
 
         if (side == PositionSide::LONG)
         {
-            sl_price = market_price - config.stop_loss_in_points.value() * symbol_info.point_value;
+            sl_price = market_price - config.stop_loss_in_points * symbol_info.point_value;
         }
         else
         {
-            sl_price = market_price + config.stop_loss_in_points.value() * symbol_info.point_value;
+            sl_price = market_price + config.stop_loss_in_points * symbol_info.point_value;
         }
     }
     else if (config.type_stop_loss == TypeTakeProfitStopLoss::PERCENT)
     {
-        if (!config.stop_loss_in_percent.has_value())
+        if (!is_set(config.stop_loss_in_percent))
         {
             throw std::invalid_argument("Stop loss in percent is not set.");
             std::exit(1);
@@ -225,16 +225,16 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
 
         if (side == PositionSide::LONG)
         {
-            sl_price = decimal_ceil(market_price - market_price * config.stop_loss_in_percent.value(), symbol_info.decimal_places);
+            sl_price = decimal_ceil(market_price - market_price * config.stop_loss_in_percent, symbol_info.decimal_places);
         }
         else
         {
-            sl_price = decimal_floor(market_price + market_price * config.stop_loss_in_percent.value(), symbol_info.decimal_places);
+            sl_price = decimal_floor(market_price + market_price * config.stop_loss_in_percent, symbol_info.decimal_places);
         }
     }
     else if (config.type_stop_loss == TypeTakeProfitStopLoss::EXTREMUM)
     {
-        if (!config.stop_loss_extremum_period.has_value())
+        if (!is_set(config.stop_loss_extremum_period))
         {
             throw std::invalid_argument("Stop loss extremum period is not set.");
             std::exit(1);
@@ -243,7 +243,7 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
         if (side == PositionSide::LONG)
         {
             double lowest_low = candles[0].low;
-            for (int i = 0; i < config.stop_loss_extremum_period.value(); i++)
+            for (int i = 0; i < config.stop_loss_extremum_period; i++)
             {
                 if (candles[i].low < lowest_low)
                 {
@@ -255,7 +255,7 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
         else
         {
             double highest_high = 0.0;
-            for (int i = candles.size() - config.stop_loss_extremum_period.value(); i < candles.size(); i++)
+            for (int i = candles.size() - config.stop_loss_extremum_period; i < candles.size(); i++)
             {
                 if (candles[i].high > highest_high)
                 {
@@ -267,25 +267,25 @@ std::tuple<double, double> calculate_tp_sl_price(double market_price, std::vecto
     }
     else if (config.type_stop_loss == TypeTakeProfitStopLoss::ATR)
     {
-        if (!config.stop_loss_atr_period.has_value())
+        if (!is_set(config.stop_loss_atr_period))
         {
             config.stop_loss_atr_period = 14; // Default value
         }
 
-        if (!config.stop_loss_atr_multiplier.has_value())
+        if (!is_set(config.stop_loss_atr_multiplier))
         {
             config.stop_loss_atr_multiplier = 1.0; // Default value
         }
 
-        std::vector<double> atr_values = ATR(config.stop_loss_atr_period.value()).calculate(candles, false);
+        std::vector<double> atr_values = ATR(config.stop_loss_atr_period).calculate(candles, false);
         double atr = atr_values[atr_values.size() - 1];
         if (side == PositionSide::LONG)
         {
-            sl_price = market_price - atr * config.stop_loss_atr_multiplier.value();
+            sl_price = market_price - atr * config.stop_loss_atr_multiplier;
         }
         else
         {
-            sl_price = market_price + atr * config.stop_loss_atr_multiplier.value();
+            sl_price = market_price + atr * config.stop_loss_atr_multiplier;
         }
     }
 
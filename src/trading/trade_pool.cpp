@@ -0,0 +1,51 @@
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "../types.hpp"
+#include "trade_pool.hpp"
+
+/**
+ * @brief Get a cleared trade vector, reusing pooled capacity when available.
+ *
+ * @param hint The capacity to reserve when a fresh vector is handed out.
+ * @return std::vector<Trade> The trade vector.
+ */
+std::vector<Trade> TradePool::acquire(size_t hint)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (!this->free_list.empty())
+        {
+            std::vector<Trade> trades = std::move(this->free_list.back());
+            this->free_list.pop_back();
+            trades.clear();
+            return trades;
+        }
+    }
+
+    std::vector<Trade> trades;
+    trades.reserve(hint);
+    return trades;
+}
+
+/**
+ * @brief Return a trade vector to the pool.
+ *
+ * @param trades The trade vector to recycle.
+ */
+void TradePool::release(std::vector<Trade> &&trades)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->free_list.push_back(std::move(trades));
+}
+
+/**
+ * @brief Get the pool shared by all the traders.
+ *
+ * @return TradePool & The global trade pool.
+ */
+TradePool &global_trade_pool()
+{
+    static TradePool pool;
+    return pool;
+}
@@ -0,0 +1,53 @@
+#ifndef TRADE_POOL_H
+#define TRADE_POOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include "../types.hpp"
+
+/**
+ * @brief Pool recycling the trade-history vectors of the traders.
+ *
+ * Every genome evaluated during training grows a std::vector<Trade>, so a
+ * generation performs thousands of allocator round-trips just for trade
+ * histories. The pool hands out cleared vectors that keep their previously
+ * grown capacity, so the hot trade-append path reuses warm storage instead
+ * of reallocating from scratch.
+ *
+ * The pool is shared between the evaluation threads: they are short-lived,
+ * so a thread-local free list would be dropped with its thread every
+ * generation. Acquire and release each take the lock once per trader, which
+ * is negligible next to the per-candle work of an evaluation.
+ */
+class TradePool
+{
+public:
+    /**
+     * @brief Get a cleared trade vector, reusing pooled capacity when available.
+     *
+     * @param hint The capacity to reserve when a fresh vector is handed out.
+     * @return std::vector<Trade> The trade vector.
+     */
+    std::vector<Trade> acquire(size_t hint = 64);
+
+    /**
+     * @brief Return a trade vector to the pool.
+     *
+     * @param trades The trade vector to recycle.
+     */
+    void release(std::vector<Trade> &&trades);
+
+private:
+    std::vector<std::vector<Trade>> free_list; // Recycled vectors keeping their capacity
+    std::mutex mutex;                          // Guards the free list across evaluation threads
+};
+
+/**
+ * @brief Get the pool shared by all the traders.
+ *
+ * @return TradePool & The global trade pool.
+ */
+TradePool &global_trade_pool();
+
+#endif // TRADE_POOL_H
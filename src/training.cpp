@@ -14,6 +14,7 @@
 #include "utils/logger.hpp"
 #include "utils/indexer.hpp"
 #include "utils/uid.hpp"
+#include "utils/string_arena.hpp"
 #include "utils/cache.hpp"
 #include "utils/read_data.hpp"
 #include "utils/time_frame.hpp"
@@ -336,9 +337,10 @@ void Training::load_indicators(bool display_progress)
 
     // Check if there are no doubloons in the indicators
     std::unordered_map<TimeFrame, std::vector<std::string>> check_indicators = {};
-    for (const auto &[tf, indicators] : this->config.training.inputs.indicators)
+    for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
     {
-        for (const auto &indicator : indicators)
+        TimeFrame tf = static_cast<TimeFrame>(i);
+        for (const auto &indicator : this->config.training.inputs.indicators[tf])
         {
             if (std::find(check_indicators[tf].begin(), check_indicators[tf].end(), indicator->id_params) != check_indicators[tf].end())
             {
@@ -352,47 +354,81 @@ void Training::load_indicators(bool display_progress)
         }
     }
 
-    std::map<TimeFrame, std::vector<Indicator *>> all_indicators = config.training.inputs.indicators;
+    const TimeFrameMap<std::vector<Indicator *>> &all_indicators = config.training.inputs.indicators;
     ProgressBar *progress_bar = display_progress ? new ProgressBar(100, this->dates.size()) : nullptr;
 
+    // Reuse the result and scratch buffers across the dates so the batches stop
+    // allocating once they have reached their working size
+    std::vector<std::vector<double>> batch_values;
+    IndicatorScratch scratch;
+
+    // The flags deciding which direction of the values is kept do not change
+    // during the loop
+    bool keep_values = this->config.strategy.can_open_long_trade.value_or(true) || (this->config.strategy.can_open_short_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false));
+    bool keep_reverse_values = this->config.strategy.can_open_short_trade.value_or(true) || (this->config.strategy.can_open_long_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false));
+
     // Loop through the dates
     for (const auto &date : this->dates)
     {
         this->indicators[date] = {};
 
         // Loop through all the indicators and calculate the values
-        for (auto const &[tf, indicators] : all_indicators)
+        for (size_t tf_index = 0; tf_index < NB_TIMEFRAMES; ++tf_index)
         {
-            for (auto const &indicator : indicators)
+            TimeFrame tf = static_cast<TimeFrame>(tf_index);
+            const std::vector<Indicator *> &indicators = all_indicators[tf];
+            if (indicators.empty())
+            {
+                continue;
+            }
+            // Get the candles for the current date
+            std::vector<Candle> current_candles = this->candles[date][tf];
+
+            // Calculate the indicator values
+            if (current_candles.size() >= CANDLES_WINDOW)
             {
-                // Get the candles for the current date
-                std::vector<Candle> current_candles = this->candles[date][tf];
+                // Calculate all the indicators of the time frame in a single batch so the
+                // candle columns are extracted once and the scratch buffers are reused
+                calculate_batch(indicators, current_candles, batch_values, scratch, !this->debug);
 
-                // Calculate the indicator values
-                if (current_candles.size() >= CANDLES_WINDOW)
+                for (size_t indicator_index = 0; indicator_index < indicators.size(); ++indicator_index)
                 {
-                    std::vector<double> values = indicator->calculate(current_candles, !this->debug);
+                    Indicator *indicator = indicators[indicator_index];
+                    std::vector<double> &values = batch_values[indicator_index];
                     std::vector<double> reverse_values = reverse_vector(values, indicator->values_range);
 
-                    for (int i = 0; i < INDICATOR_WINDOW; i++)
+                    // Look up the result vectors once and reserve the window
+                    // size up front instead of paying a map lookup, a key
+                    // concatenation and possible reallocations per value
+                    if (keep_values)
                     {
-                        if (this->config.strategy.can_open_long_trade.value_or(true) || (this->config.strategy.can_open_short_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false)))
+                        std::vector<double> &out = this->indicators[date][tf][indicator->id];
+                        out.reserve(INDICATOR_WINDOW);
+                        for (int i = 0; i < INDICATOR_WINDOW; i++)
                         {
-                            this->indicators[date][tf][indicator->id].push_back(values[values.size() - INDICATOR_WINDOW + i]);
+                            out.push_back(values[values.size() - INDICATOR_WINDOW + i]);
                         }
-                        if (this->config.strategy.can_open_short_trade.value_or(true) || (this->config.strategy.can_open_long_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false)))
+                    }
+                    if (keep_reverse_values)
+                    {
+                        std::vector<double> &out = this->indicators[date][tf][indicator->id + "-reverse"];
+                        out.reserve(INDICATOR_WINDOW);
+                        for (int i = 0; i < INDICATOR_WINDOW; i++)
                         {
-                            this->indicators[date][tf][indicator->id + "-reverse"].push_back(reverse_values[reverse_values.size() - INDICATOR_WINDOW + i]);
+                            out.push_back(reverse_values[reverse_values.size() - INDICATOR_WINDOW + i]);
                         }
                     }
                 }
-                else
+            }
+            else
+            {
+                for (auto const &indicator : indicators)
                 {
-                    if (this->config.strategy.can_open_long_trade.value_or(true) || (this->config.strategy.can_open_short_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false)))
+                    if (keep_values)
                     {
                         this->indicators[date][tf][indicator->id] = std::vector<double>(INDICATOR_WINDOW, 0.0);
                     }
-                    if (this->config.strategy.can_open_short_trade.value_or(true) || (this->config.strategy.can_open_long_trade.value_or(true) && this->config.strategy.can_close_trade.value_or(false)))
+                    if (keep_reverse_values)
                     {
                         this->indicators[date][tf][indicator->id + "-reverse"] = std::vector<double>(INDICATOR_WINDOW, 0.0);
                     }
@@ -420,7 +456,7 @@ void Training::load_indicators(bool display_progress)
 void Training::load_base_currency_conversion_rate(bool display_progress)
 {
     std::string account_currency = this->config.general.account_currency;
-    std::string base_currency_traded = symbol_infos[this->config.general.symbol].base;
+    std::string base_currency_traded = interned_string(symbol_infos[this->config.general.symbol].base);
     TimeFrame loop_timeframe = this->config.strategy.timeframe;
 
     if (account_currency == base_currency_traded)
@@ -429,7 +465,7 @@ void Training::load_base_currency_conversion_rate(bool display_progress)
 
         for (const auto &[date, candles_data] : this->candles)
         {
-            base_currency_conversion_rate[date] = 1.0;
+            base_currency_conversion_rate.set(date, 1.0);
 
             if (progress_bar)
             {
@@ -453,7 +489,7 @@ void Training::load_base_currency_conversion_rate(bool display_progress)
 
         for (const auto &candle : data)
         {
-            base_currency_conversion_rate[candle.date] = candle.close;
+            base_currency_conversion_rate.set(candle.date, candle.close);
 
             if (progress_bar)
             {
@@ -488,28 +524,15 @@ void Training::cache_data(bool display_progress)
         double current_base_currency_conversion_rate = {};
 
         // Get the candles for the current date
-        for (const auto &[timeframe, candles] : this->candles[date])
-        {
-            current_candles[timeframe] = candles;
-        }
+        current_candles = this->candles[date];
 
         // Get the indicators for the current date
-        for (const auto &[timeframe, indicators] : this->indicators[date])
-        {
-            current_indicators[timeframe] = indicators;
-        }
+        current_indicators = this->indicators[date];
 
         // Get the base currency conversion rate for the current date
         for (const auto &candle : current_candles[loop_timeframe])
         {
-            if (base_currency_conversion_rate.find(candle.date) != base_currency_conversion_rate.end())
-            {
-                current_base_currency_conversion_rate = base_currency_conversion_rate[candle.date];
-            }
-            else
-            {
-                current_base_currency_conversion_rate = 1.0;
-            }
+            current_base_currency_conversion_rate = base_currency_conversion_rate.at_or(candle.date, 1.0);
         }
 
         // Cache the data
@@ -544,9 +567,9 @@ int Training::count_indicators() const
     int nb_indicators = 0;
 
     // Count the number of indicators
-    for (const auto &tf_indicators : this->config.training.inputs.indicators)
+    for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
     {
-        nb_indicators += tf_indicators.second.size();
+        nb_indicators += this->config.training.inputs.indicators[static_cast<TimeFrame>(i)].size();
     }
 
     if (!this->config.strategy.can_open_long_trade.value_or(true) && !this->config.strategy.can_open_short_trade.value_or(true))
@@ -580,9 +603,13 @@ int Training::count_indicators() const
 std::vector<TimeFrame> Training::get_all_timeframes() const
 {
     std::vector<TimeFrame> timeframes;
-    for (const auto &indicators : this->config.training.inputs.indicators)
+    for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
     {
-        timeframes.push_back(indicators.first);
+        TimeFrame tf = static_cast<TimeFrame>(i);
+        if (!this->config.training.inputs.indicators[tf].empty())
+        {
+            timeframes.push_back(tf);
+        }
     }
     return timeframes;
 }
@@ -609,11 +636,13 @@ void Training::evaluate_genome(neat::Genome *genome, int generation)
         std::string date_string = std::to_string(date);
         if (this->cache->has(date_string))
         {
-            // Get the data from cache
-            CandlesData current_candles = this->cache->get(date_string).candles;
-            IndicatorsData current_indicators = this->cache->get(date_string).indicators;
-            double current_base_currency_conversion_rate = this->cache->get(date_string).base_currency_conversion_rate;
-            std::vector<PositionInfo> position = this->config.training.inputs.position;
+            // Get the data from cache, by reference: one lookup per date and
+            // no copy of the candle and indicator maps
+            const CachedData &cached_data = this->cache->get(date_string);
+            const CandlesData &current_candles = cached_data.candles;
+            const IndicatorsData &current_indicators = cached_data.indicators;
+            double current_base_currency_conversion_rate = cached_data.base_currency_conversion_rate;
+            const std::vector<PositionInfo> &position = this->config.training.inputs.position;
 
             // Do not continue if the trader is dead
             if (trader->dead)
@@ -675,16 +704,28 @@ int Training::run()
             // Calculate the average fitness of the generation
             this->average_fitnesses[this->current_generation] = population->average_fitness;
 
-            // Find the trader with the best genome of the generation
+            // Find the trader with the best genome of the generation. The
+            // population only replaces its best genome when the fitness
+            // improves, so when a generation declines the id belongs to an
+            // earlier generation and no trader of this one matches: keep the
+            // previous best trader in that case, and only delete it once a
+            // replacement is found.
+            Trader *generation_best_trader = nullptr;
             for (const auto &trader : this->current_generation_traders)
             {
                 if (trader->genome->id == population->best_genome->id)
                 {
-                    this->best_trader = trader;
+                    generation_best_trader = trader;
                     break;
                 }
             }
 
+            if (generation_best_trader != nullptr && generation_best_trader != this->best_trader)
+            {
+                delete this->best_trader;
+                this->best_trader = generation_best_trader;
+            }
+
             if (this->best_trader == nullptr)
             {
                 std::cerr << "Error: the genome of the best trader of the generation " << this->current_generation << " is not found." << std::endl;
@@ -743,7 +784,15 @@ int Training::run()
             // Update the current generation
             this->current_generation++;
 
-            // Reset the traders of the current generation
+            // Delete the traders of the finished generation (the best one is
+            // kept for the reports), returning their trade histories to the pool
+            for (const auto &trader : this->current_generation_traders)
+            {
+                if (trader != this->best_trader)
+                {
+                    delete trader;
+                }
+            }
             this->current_generation_traders.clear();
 
             // Save the training process
@@ -813,11 +862,13 @@ int Training::test(neat::Genome *genome, int generation)
         std::string date_string = std::to_string(date);
         if (this->cache->has(date_string))
         {
-            // Get the data from cache
-            CandlesData current_candles = this->cache->get(date_string).candles;
-            IndicatorsData current_indicators = this->cache->get(date_string).indicators;
-            double current_base_currency_conversion_rate = this->cache->get(date_string).base_currency_conversion_rate;
-            std::vector<PositionInfo> position = this->config.training.inputs.position;
+            // Get the data from cache, by reference: one lookup per date and
+            // no copy of the candle and indicator maps
+            const CachedData &cached_data = this->cache->get(date_string);
+            const CandlesData &current_candles = cached_data.candles;
+            const IndicatorsData &current_indicators = cached_data.indicators;
+            double current_base_currency_conversion_rate = cached_data.base_currency_conversion_rate;
+            const std::vector<PositionInfo> &position = this->config.training.inputs.position;
 
             // Update the individual
             trader->update(current_candles);
@@ -867,6 +918,8 @@ int Training::test(neat::Genome *genome, int generation)
         trader->logger->close();
     }
 
+    delete trader;
+
     return 0;
 }
 
@@ -880,7 +933,7 @@ int Training::test(neat::Genome *genome, int generation)
 int Training::evaluate_trader_with_monte_carlo_simulation(Trader *trader, int nb_simulations, double note_threshold)
 {
     // Number of trades to simulate in the testing period proportionally to the number of trades in the training period
-    int nb_trades_to_simulate = trader->stats.total_trades * this->test_dates.size() / this->training_dates.size();
+    int nb_trades_to_simulate = trader->cold->stats.total_trades * this->test_dates.size() / this->training_dates.size();
 
     // Monte Carlo simulation
     std::vector<double> simulation_final_balance = std::vector<double>(nb_simulations, this->config.general.initial_balance);
@@ -896,12 +949,12 @@ int Training::evaluate_trader_with_monte_carlo_simulation(Trader *trader, int nb
             std::mt19937 gen(rd());
             std::uniform_real_distribution<double> distribution(0, 1);
             double random = distribution(gen);
-            bool winning_trade = random < trader->stats.win_rate;
+            bool winning_trade = random < trader->cold->stats.win_rate;
             double risk_amount = balance * this->config.strategy.risk_per_trade;
 
             if (winning_trade)
             {
-                balance += risk_amount * trader->stats.profit_factor;
+                balance += risk_amount * trader->cold->stats.profit_factor;
             }
             else
             {
@@ -935,17 +988,17 @@ int Training::evaluate_trader_with_monte_carlo_simulation(Trader *trader, int nb
 
     // Check if the results are consistent with the training period by calculate a note
     double note = 0.0;
-    if (trader->stats.final_balance < worse_case)
+    if (trader->cold->stats.final_balance < worse_case)
     {
         note = 0.0;
     }
-    else if (trader->stats.final_balance > best_case)
+    else if (trader->cold->stats.final_balance > best_case)
     {
         note = 1.0;
     }
     else
     {
-        note = (trader->stats.final_balance - worse_case) / (best_case - worse_case);
+        note = (trader->cold->stats.final_balance - worse_case) / (best_case - worse_case);
     }
 
     if (this->debug)
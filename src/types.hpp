@@ -13,21 +13,55 @@
 #endif
 
 #include <string>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
 #include <unordered_map>
 #include <map>
+#include <functional>
 #include <vector>
 #include <ctime>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
 #include <optional>
+#include <type_traits>
 #include "neat/config.hpp"
 #include "indicators/indicator.hpp"
+#include "utils/aligned_allocator.hpp"
 
 class Indicator; // Forward declaration
 
+// Sentinels marking an unset optional config value. Storing a plain int or
+// double with a sentinel instead of a std::optional halves the field size and
+// turns the presence check into a single compare.
+inline constexpr int UNSET_INT = std::numeric_limits<int>::min();
+inline const double UNSET_DOUBLE = std::numeric_limits<double>::quiet_NaN();
+
+/**
+ * @brief Check if a sentinel-packed config value is set.
+ * @param value The config value.
+ * @return bool True if the value is set.
+ */
+inline bool is_set(int value) { return value != UNSET_INT; }
+inline bool is_set(double value) { return !std::isnan(value); }
+
+/**
+ * @brief Get a sentinel-packed config value, or a fallback if it is unset.
+ * @param value The config value.
+ * @param fallback The fallback returned when the value is unset.
+ * @return The config value or the fallback.
+ */
+inline int value_or(int value, int fallback) { return is_set(value) ? value : fallback; }
+inline double value_or(double value, double fallback) { return is_set(value) ? value : fallback; }
+
 /**
  * @brief Enum for different time frames.
  */
-enum class TimeFrame
+enum class TimeFrame : uint8_t
 {
     M1,
     M5,
@@ -39,6 +73,80 @@ enum class TimeFrame
     D1
 };
 
+// Number of values of the TimeFrame enum
+inline constexpr size_t NB_TIMEFRAMES = 8;
+
+// Identity hash for the remaining unordered_map<TimeFrame, ...> instances:
+// the enum values are already dense in [0, NB_TIMEFRAMES), so hashing them is
+// a no-op with zero collisions for any bucket count of at least 8
+namespace std
+{
+    template <>
+    struct hash<TimeFrame>
+    {
+        size_t operator()(TimeFrame time_frame) const noexcept { return static_cast<size_t>(time_frame); }
+    };
+}
+
+// Number of minutes of each time frame, indexed by the enum value, so the
+// conversion is a single table load instead of an 8-way switch
+inline constexpr std::array<int, NB_TIMEFRAMES> TIME_FRAME_MINUTES = {1, 5, 15, 30, 60, 240, 720, 1440};
+
+/**
+ * @brief Map from time frame to a value, stored as a fixed-size array.
+ *
+ * TimeFrame is a dense enum of NB_TIMEFRAMES values, so the values are kept
+ * in a plain array indexed by the enum instead of a hash map. An access is a
+ * single indexed load without hashing or bucket chasing, and no buckets are
+ * allocated at startup. Every slot exists up front with a default-constructed
+ * value; a time frame without data simply holds an empty value.
+ */
+template <typename T>
+struct TimeFrameMap
+{
+    TimeFrameMap() = default;
+
+    /**
+     * @brief Construct from a list of (time frame, value) pairs.
+     * @param items Pairs to store.
+     */
+    TimeFrameMap(std::initializer_list<std::pair<TimeFrame, T>> items)
+    {
+        for (const auto &item : items)
+        {
+            (*this)[item.first] = item.second;
+        }
+    }
+
+    T &operator[](TimeFrame tf) { return this->values[static_cast<size_t>(tf)]; }
+    const T &operator[](TimeFrame tf) const { return this->values[static_cast<size_t>(tf)]; }
+
+    T &at(TimeFrame tf) { return this->values[static_cast<size_t>(tf)]; }
+    const T &at(TimeFrame tf) const { return this->values[static_cast<size_t>(tf)]; }
+
+    /**
+     * @brief Check if every time frame holds an empty value.
+     * @return bool True if no time frame has data.
+     */
+    bool empty() const
+    {
+        for (const T &value : this->values)
+        {
+            if (!value.empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator==(const TimeFrameMap &other) const { return this->values == other.values; }
+    bool operator!=(const TimeFrameMap &other) const { return !(*this == other); }
+
+private:
+    std::array<T, NB_TIMEFRAMES> values{};
+};
+
 /**
  * @brief Struct representing a candle.
  */
@@ -49,17 +157,137 @@ struct Candle
     double high;
     double low;
     double close;
-    double tick_volume;
-    double volume;
-    double spread;
+    float tick_volume; // Stored as float: tick counts and spreads are small
+    float volume;      // values that fit in single precision, and the narrower
+    float spread;      // fields pack more candles per cache line
+};
+
+// Keep the candle packed: 8 bytes of date, 32 bytes of prices and 12 bytes of
+// volumes/spread round up to 56 bytes with alignment, against 72 when every
+// field was a double.
+static_assert(sizeof(Candle) == 56, "Candle is expected to pack into 56 bytes");
+
+// Keep the candle trivially copyable so vector growth and the cache
+// serialization can move candles with memcpy instead of per-element copies
+static_assert(std::is_trivially_copyable_v<Candle>);
+static_assert(std::is_standard_layout_v<Candle>);
+
+/**
+ * @brief Struct representing candles as parallel column arrays (structure of arrays).
+ *
+ * Each indicator only streams the columns it needs, so storing the candle data
+ * as contiguous arrays avoids loading the unused fields of Candle on every access.
+ * The columns are cache-line aligned so the SIMD loads of the kernels never
+ * straddle two lines.
+ */
+struct CandleSoA
+{
+    AlignedVector<double> open;   // Open prices of the candles
+    AlignedVector<double> high;   // High prices of the candles
+    AlignedVector<double> low;    // Low prices of the candles
+    AlignedVector<double> close;  // Close prices of the candles
+    AlignedVector<double> volume; // Volumes of the candles
+
+    /**
+     * @brief Get the number of candles.
+     *
+     * @return size_t The number of candles.
+     */
+    size_t size() const { return close.size(); }
+};
+
+/**
+ * @brief Struct representing candles as parallel float32 column arrays.
+ *
+ * Price series do not need the full double precision for scale-invariant
+ * indicators: halving the byte width doubles the cache-resident history and
+ * the SIMD lane count. Used as an opt-in source for float-based kernels.
+ */
+struct CandleSoAf
+{
+    AlignedVector<float> open;   // Open prices of the candles
+    AlignedVector<float> high;   // High prices of the candles
+    AlignedVector<float> low;    // Low prices of the candles
+    AlignedVector<float> close;  // Close prices of the candles
+    AlignedVector<float> volume; // Volumes of the candles
+
+    /**
+     * @brief Get the number of candles.
+     *
+     * @return size_t The number of candles.
+     */
+    size_t size() const { return close.size(); }
+};
+
+/**
+ * @brief Time series of conversion rates, sorted by date.
+ *
+ * The rates are loaded once and then only read, so they are kept as two
+ * parallel sorted arrays looked up with a binary search instead of an
+ * RB-tree map: no node allocations, and the search only touches the
+ * cache-local date column.
+ */
+struct RateSeries
+{
+    /**
+     * @brief Set the rate for a date, keeping the series sorted.
+     * @param date The date of the rate.
+     * @param rate The conversion rate.
+     */
+    void set(time_t date, double rate)
+    {
+        if (this->dates.empty() || date > this->dates.back())
+        {
+            this->dates.push_back(date);
+            this->rates.push_back(rate);
+            return;
+        }
+        auto it = std::lower_bound(this->dates.begin(), this->dates.end(), date);
+        size_t index = it - this->dates.begin();
+        if (it != this->dates.end() && *it == date)
+        {
+            this->rates[index] = rate;
+        }
+        else
+        {
+            this->dates.insert(it, date);
+            this->rates.insert(this->rates.begin() + index, rate);
+        }
+    }
+
+    /**
+     * @brief Get the rate for a date, or a fallback if the date is unknown.
+     * @param date The date of the rate.
+     * @param fallback The rate returned when the date is not in the series.
+     * @return double The conversion rate.
+     */
+    double at_or(time_t date, double fallback) const
+    {
+        auto it = std::lower_bound(this->dates.begin(), this->dates.end(), date);
+        if (it != this->dates.end() && *it == date)
+        {
+            return this->rates[it - this->dates.begin()];
+        }
+        return fallback;
+    }
+
+    /**
+     * @brief Check if the series holds no rates.
+     * @return bool True if the series is empty.
+     */
+    bool empty() const { return this->dates.empty(); }
+
+private:
+    std::vector<time_t> dates; // Dates of the rates, sorted ascending
+    std::vector<double> rates; // Conversion rates, parallel to the dates
 };
 
 /**
  * @brief Type definitions for different data structures.
  */
-using CandlesData = std::unordered_map<TimeFrame, std::vector<Candle>>;
-using IndicatorsData = std::unordered_map<TimeFrame, std::map<std::string, std::vector<double>>>;
-using BaseCurrencyConversionRateData = std::map<time_t, double>;
+using CandlesData = TimeFrameMap<std::vector<Candle>>;
+using IndicatorsData = TimeFrameMap<std::unordered_map<std::string, std::vector<double>>>;
+using BaseCurrencyConversionRateData = RateSeries;
 
 /**
  * @brief Struct representing cached data with date information.
@@ -74,7 +302,7 @@ struct CachedData
 /**
  * @brief Enum for position side (LONG or SHORT).
  */
-enum class PositionSide
+enum class PositionSide : uint8_t
 {
     LONG,
     SHORT
@@ -83,7 +311,7 @@ enum class PositionSide
 /**
  * @brief Enum for position information.
  */
-enum class PositionInfo
+enum class PositionInfo : uint8_t
 {
     TYPE,
     PNL,
@@ -102,10 +330,13 @@ struct Position
     double pnl;         // Profit and Loss of the position
 };
 
+static_assert(std::is_trivially_copyable_v<Position>);
+static_assert(std::is_standard_layout_v<Position>);
+
 /**
  * @brief Enum for order type (TAKE_PROFIT or STOP_LOSS).
  */
-enum class OrderType
+enum class OrderType : uint8_t
 {
     TAKE_PROFIT,
     STOP_LOSS
@@ -114,7 +345,7 @@ enum class OrderType
 /**
  * @brief Enum for order side (LONG or SHORT).
  */
-enum class OrderSide
+enum class OrderSide : uint8_t
 {
     LONG,
     SHORT
@@ -130,14 +361,103 @@ struct Order
     double price;   // Price of the order
 };
 
+static_assert(std::is_trivially_copyable_v<Order>);
+static_assert(std::is_standard_layout_v<Order>);
+
+/**
+ * @brief Fixed-capacity inline buffer of pending orders.
+ *
+ * A trader never holds more than a take profit and a stop loss order at a
+ * time, so the orders are stored inline instead of in a heap-allocated
+ * vector. This avoids a heap allocation per trader per generation and keeps
+ * the orders on the same cache lines as the trader that iterates them.
+ */
+struct OrderBuffer
+{
+    static constexpr size_t max_orders = 4; // Capacity of the inline storage
+
+    /**
+     * @brief Replace the content with the orders of an initializer list.
+     * @param orders Orders to store.
+     * @return OrderBuffer & Reference to the buffer.
+     */
+    OrderBuffer &operator=(std::initializer_list<Order> orders)
+    {
+        this->count = 0;
+        for (const Order &order : orders)
+        {
+            this->push_back(order);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Append an order. Orders beyond the capacity are dropped.
+     * @param order Order to append.
+     */
+    void push_back(const Order &order)
+    {
+        if (this->count < max_orders)
+        {
+            this->orders[this->count] = order;
+            ++this->count;
+        }
+        else
+        {
+            std::cerr << "The order buffer is full, the order is dropped." << std::endl;
+        }
+    }
+
+    /**
+     * @brief Get the number of orders.
+     * @return size_t Number of orders.
+     */
+    size_t size() const { return this->count; }
+
+    /**
+     * @brief Remove all the orders.
+     */
+    void clear() { this->count = 0; }
+
+    Order &operator[](size_t index) { return this->orders[index]; }
+    const Order &operator[](size_t index) const { return this->orders[index]; }
+
+    Order *begin() { return this->orders; }
+    Order *end() { return this->orders + this->count; }
+    const Order *begin() const { return this->orders; }
+    const Order *end() const { return this->orders + this->count; }
+
+private:
+    Order orders[max_orders]; // Inline storage for the orders
+    size_t count = 0;         // Number of orders currently stored
+};
+
+// Minutes since the Unix epoch. The candle data has at best 1-minute
+// resolution, so a 32-bit minute count (good until the year ~10136) replaces
+// the 8-byte time_t in the trade records.
+using EpochMinute = uint32_t;
+
+/**
+ * @brief Convert a minute offset back to a Unix timestamp.
+ * @param minute The minutes since the epoch.
+ * @return time_t The Unix timestamp.
+ */
+inline time_t to_time_t(EpochMinute minute) { return static_cast<time_t>(minute) * 60; }
+
+/**
+ * @brief Convert a Unix timestamp to a minute offset.
+ * @param timestamp The Unix timestamp.
+ * @return EpochMinute The minutes since the epoch.
+ */
+inline EpochMinute to_minute(time_t timestamp) { return static_cast<EpochMinute>(timestamp / 60); }
+
 /**
  * @brief Struct representing a trade.
  */
 struct Trade
 {
-    PositionSide side;      // Side of the trade
-    time_t entry_date;      // Entry date of the trade
-    time_t exit_date;       // Exit date of the trade
+    EpochMinute entry_date; // Entry date of the trade, in minutes since the epoch
+    EpochMinute exit_date;  // Exit date of the trade, in minutes since the epoch
     double entry_price;     // Entry price of the trade
     double exit_price;      // Exit price of the trade
     double size;            // Size of the trade
@@ -146,24 +466,33 @@ struct Trade
     double pnl_net_percent; // Profit and Loss minus the fees of the balance
     double fees;            // Fees of the trade
     int duration;           // Duration of the trade
+    PositionSide side;      // Side of the trade
     bool closed;            // Whether the trade is closed
 };
 
+// Keep the trade packed: the two minute offsets share one 8-byte slot, the
+// fields are ordered wide-to-narrow, and the 1-byte side and closed flags
+// share the tail of the int's alignment slot instead of forcing their own
+// padded words.
+static_assert(sizeof(Trade) == 72, "Trade is expected to pack into 72 bytes");
+static_assert(std::is_trivially_copyable_v<Trade>);
+static_assert(std::is_standard_layout_v<Trade>);
+
 /**
  * @brief Struct representing symbol information.
  */
 struct SymbolInfo
 {
-    std::string asset;           // Asset of the symbol
-    std::string base;            // Base currency of the symbol
-    int decimal_places;          // Number of decimal places for the price precision
-    double point_value;          // Value of one point movement in the symbol's price
-    int contract_size;           // Contract size of the symbol
-    double min_lot_size;         // Minimum lot size allowed for the symbol
-    double max_lot_size;         // Maximum lot size allowed for the symbol
-    double lot_size_step;        // Step size for lot size increments/decrements
-    double commission_per_lot;   // Commission per lot traded for the symbol
-    std::string commission_base; // Base currency for commission calculation
+    uint16_t asset;            // Asset of the symbol, interned with intern_string
+    uint16_t base;             // Base currency of the symbol, interned with intern_string
+    int decimal_places;        // Number of decimal places for the price precision
+    double point_value;        // Value of one point movement in the symbol's price
+    int contract_size;         // Contract size of the symbol
+    double min_lot_size;       // Minimum lot size allowed for the symbol
+    double max_lot_size;       // Maximum lot size allowed for the symbol
+    double lot_size_step;      // Step size for lot size increments/decrements
+    double commission_per_lot; // Commission per lot traded for the symbol
+    uint16_t commission_base;  // Base currency for commission calculation, interned with intern_string
 };
 
 /**
@@ -174,15 +503,15 @@ struct GeneralConfig
     std::string name;             // Name of the trading configuration
     std::string version;          // Version of the trading configuration
     std::string symbol;           // Trading symbol
-    double initial_balance;       // Initial account balance
+    double initial_balance = 0.0; // Initial account balance
     std::string account_currency; // Account currency
-    int leverage;                 // Leverage
+    int leverage = 0;             // Leverage
 };
 
 /**
  * @brief Enum for different types of take profit/stop loss configurations.
  */
-enum class TypeTakeProfitStopLoss
+enum class TypeTakeProfitStopLoss : uint8_t
 {
     POINTS,
     PERCENT,
@@ -193,7 +522,7 @@ enum class TypeTakeProfitStopLoss
 /**
  * @brief Enum for different types of trailing stop loss configurations.
  */
-enum class TypeTrailingStopLoss
+enum class TypeTrailingStopLoss : uint8_t
 {
     POINTS,
     PERCENT,
@@ -204,18 +533,18 @@ enum class TypeTrailingStopLoss
  */
 struct TakeProfitStopLossConfig
 {
-    TypeTakeProfitStopLoss type_stop_loss;            // Type of stop loss
-    std::optional<int> stop_loss_in_points;           // Stop loss in points
-    std::optional<double> stop_loss_in_percent;       // Stop loss as a percentage
-    std::optional<int> stop_loss_extremum_period;     // Stop loss period for extremum
-    std::optional<int> stop_loss_atr_period;          // Stop loss period for ATR
-    std::optional<double> stop_loss_atr_multiplier;   // Stop loss multiplier for ATR
-    TypeTakeProfitStopLoss type_take_profit;          // Type of take profit
-    std::optional<int> take_profit_in_points;         // Take profit in points
-    std::optional<double> take_profit_in_percent;     // Take profit as a percentage
-    std::optional<int> take_profit_extremum_period;   // Take profit period for extremum
-    std::optional<int> take_profit_atr_period;        // Take profit period for ATR
-    std::optional<double> take_profit_atr_multiplier; // Take profit multiplier for ATR
+    TypeTakeProfitStopLoss type_stop_loss = TypeTakeProfitStopLoss::POINTS;   // Type of stop loss
+    int stop_loss_in_points = UNSET_INT;                                      // Stop loss in points
+    double stop_loss_in_percent = UNSET_DOUBLE;                               // Stop loss as a percentage
+    int stop_loss_extremum_period = UNSET_INT;                                // Stop loss period for extremum
+    int stop_loss_atr_period = UNSET_INT;                                     // Stop loss period for ATR
+    double stop_loss_atr_multiplier = UNSET_DOUBLE;                           // Stop loss multiplier for ATR
+    TypeTakeProfitStopLoss type_take_profit = TypeTakeProfitStopLoss::POINTS; // Type of take profit
+    int take_profit_in_points = UNSET_INT;                                    // Take profit in points
+    double take_profit_in_percent = UNSET_DOUBLE;                             // Take profit as a percentage
+    int take_profit_extremum_period = UNSET_INT;                              // Take profit period for extremum
+    int take_profit_atr_period = UNSET_INT;                                   // Take profit period for ATR
+    double take_profit_atr_multiplier = UNSET_DOUBLE;                         // Take profit multiplier for ATR
 };
 
 /**
@@ -223,11 +552,71 @@ struct TakeProfitStopLossConfig
  */
 struct TrailingStopLossConfig
 {
-    TypeTrailingStopLoss type;                           // Type of trailing stop loss configuration (POINTS or PERCENT)
-    std::optional<int> activation_level_in_points;       // Activation level in points before trailing stop loss is activated
-    std::optional<double> activation_level_in_percent;   // Activation level as a percentage before trailing stop loss is activated
-    std::optional<int> trailing_stop_loss_in_points;     // Trailing stop loss in points
-    std::optional<double> trailing_stop_loss_in_percent; // Trailing stop loss as a percentage
+    TypeTrailingStopLoss type = TypeTrailingStopLoss::POINTS; // Type of trailing stop loss configuration (POINTS or PERCENT)
+    int activation_level_in_points = UNSET_INT;               // Activation level in points before trailing stop loss is activated
+    double activation_level_in_percent = UNSET_DOUBLE;        // Activation level as a percentage before trailing stop loss is activated
+    int trailing_stop_loss_in_points = UNSET_INT;             // Trailing stop loss in points
+    double trailing_stop_loss_in_percent = UNSET_DOUBLE;      // Trailing stop loss as a percentage
+};
+
+/**
+ * @brief Struct representing the trading hours of a single day.
+ *
+ * The 24 hour slots are packed into a 32-bit mask (bit h set means trading is
+ * allowed during hour h), so the per-candle schedule check is a single shift
+ * and test instead of a heap-allocated std::vector<bool> lookup.
+ */
+struct DaySchedule
+{
+    DaySchedule() = default;
+
+    /**
+     * @brief Construct a day schedule from 24 hour slots.
+     * @param hours The hour slots (true means trading is allowed).
+     */
+    DaySchedule(const std::vector<bool> &hours)
+    {
+        for (size_t h = 0; h < hours.size() && h < 24; ++h)
+        {
+            if (hours[h])
+            {
+                mask |= (1u << h);
+            }
+        }
+    }
+
+    /**
+     * @brief Check if trading is allowed during the given hour.
+     * @param hour The hour of the day (0-23).
+     * @return bool True if trading is allowed.
+     */
+    bool operator[](int hour) const { return (mask >> hour) & 1u; }
+
+    /**
+     * @brief Check if trading is allowed during at least one hour of the day.
+     * @return bool True if the day has a trading session.
+     */
+    bool any() const { return mask != 0; }
+
+    /**
+     * @brief Unpack the mask back into 24 hour slots (for serialization).
+     * @return std::vector<bool> The hour slots.
+     */
+    std::vector<bool> to_hours() const
+    {
+        std::vector<bool> hours(24);
+        for (int h = 0; h < 24; ++h)
+        {
+            hours[h] = (*this)[h];
+        }
+        return hours;
+    }
+
+    bool operator==(const DaySchedule &other) const { return mask == other.mask; }
+    bool operator!=(const DaySchedule &other) const { return mask != other.mask; }
+
+private:
+    uint32_t mask = 0; // One bit per hour of the day
 };
 
 /**
@@ -235,13 +624,13 @@ struct TrailingStopLossConfig
  */
 struct TradingSchedule
 {
-    std::vector<bool> monday;    // Trading schedule for Monday
-    std::vector<bool> tuesday;   // Trading schedule for Tuesday
-    std::vector<bool> wednesday; // Trading schedule for Wednesday
-    std::vector<bool> thursday;  // Trading schedule for Thursday
-    std::vector<bool> friday;    // Trading schedule for Friday
-    std::vector<bool> saturday;  // Trading schedule for Saturday
-    std::vector<bool> sunday;    // Trading schedule for Sunday
+    DaySchedule monday;    // Trading schedule for Monday
+    DaySchedule tuesday;   // Trading schedule for Tuesday
+    DaySchedule wednesday; // Trading schedule for Wednesday
+    DaySchedule thursday;  // Trading schedule for Thursday
+    DaySchedule friday;    // Trading schedule for Friday
+    DaySchedule saturday;  // Trading schedule for Saturday
+    DaySchedule sunday;    // Trading schedule for Sunday
 };
 
 /**
@@ -249,13 +638,13 @@ struct TradingSchedule
  */
 struct StrategyConfig
 {
-    TimeFrame timeframe;                                             // Time frame with which the strategy is used
-    double risk_per_trade;                                           // Risk per trade in % of capital
-    std::optional<int> maximum_trades_per_day;                       // Maximum trades per day allowed
-    std::optional<double> maximum_spread;                            // Maximum spread allowed
-    std::optional<int> minimum_trade_duration;                       // Minimum trade duration
-    std::optional<int> maximum_trade_duration;                       // Maximum trade duration
-    std::optional<int> minimum_duration_before_next_trade;           // Minimum duration before the next trade
+    TimeFrame timeframe = TimeFrame::M1;                             // Time frame with which the strategy is used
+    double risk_per_trade = 0.0;                                     // Risk per trade in % of capital
+    int maximum_trades_per_day = UNSET_INT;                          // Maximum trades per day allowed
+    double maximum_spread = UNSET_DOUBLE;                            // Maximum spread allowed
+    int minimum_trade_duration = UNSET_INT;                          // Minimum trade duration
+    int maximum_trade_duration = UNSET_INT;                          // Maximum trade duration
+    int minimum_duration_before_next_trade = UNSET_INT;              // Minimum duration before the next trade
     std::optional<bool> can_close_trade;                             // Whether the strategy can close a trade
     std::optional<bool> can_open_long_trade;                         // Whether the strategy can open a long trade
     std::optional<bool> can_open_short_trade;                        // Whether the strategy can open a short trade
@@ -269,8 +658,8 @@ struct StrategyConfig
  */
 struct NeuralNetworkInputs
 {
-    std::map<TimeFrame, std::vector<Indicator *>> indicators; // Indicators
-    std::vector<PositionInfo> position;                       // Position information (TYPE, PNL, DURATION)
+    TimeFrameMap<std::vector<Indicator *>> indicators; // Indicators per time frame; a time frame without indicators holds an empty slot
+    std::vector<PositionInfo> position;                // Position information (TYPE, PNL, DURATION)
 };
 
 /**
@@ -278,14 +667,14 @@ struct NeuralNetworkInputs
  */
 struct TrainingConfig
 {
-    int generations;                                 // Number of generations for training
-    std::optional<double> bad_trader_threshold;      // If the trader balance is below this threshold, the trader dies
-    std::optional<double> inactive_trader_threshold; // If during this number of candles the trader does not make any trade, the trader dies
-    time_t training_start_date;                      // Start date for training
-    time_t training_end_date;                        // End date for training
-    time_t test_start_date;                          // Start date for testing
-    time_t test_end_date;                            // End date for testing
-    std::optional<double> decision_threshold;        // Below this threshold, the trader does not make any decision
+    int generations = 0;                             // Number of generations for training
+    double bad_trader_threshold = UNSET_DOUBLE;      // If the trader balance is below this threshold, the trader dies
+    double inactive_trader_threshold = UNSET_DOUBLE; // If during this number of candles the trader does not make any trade, the trader dies
+    time_t training_start_date = 0;                  // Start date for training
+    time_t training_end_date = 0;                    // End date for training
+    time_t test_start_date = 0;                      // Start date for testing
+    time_t test_end_date = 0;                        // End date for testing
+    double decision_threshold = UNSET_DOUBLE;        // Below this threshold, the trader does not make any decision
     NeuralNetworkInputs inputs;                      // Inputs for neural network
 };
 
@@ -295,14 +684,14 @@ struct TrainingConfig
 struct EvaluationConfig
 {
     std::optional<bool> maximize_nb_trades;          // Maximize the number of trades
-    std::optional<int> minimum_nb_trades;            // Minimum number of trades
-    std::optional<int> maximum_trade_duration;       // Maximum trade duration
-    std::optional<double> expected_return_per_day;   // Expected return per day in % of capital
-    std::optional<double> expected_return_per_month; // Expected return per month in % of capital
-    std::optional<double> expected_return;           // Expected return per year in % of capital
-    std::optional<double> maximum_drawdown;          // Maximum drawdown in % of capital
-    std::optional<double> minimum_winrate;           // Minimum win rate in %
-    std::optional<double> minimum_profit_factor;     // Minimum profit factor
+    int minimum_nb_trades = UNSET_INT;               // Minimum number of trades
+    int maximum_trade_duration = UNSET_INT;          // Maximum trade duration
+    double expected_return_per_day = UNSET_DOUBLE;   // Expected return per day in % of capital
+    double expected_return_per_month = UNSET_DOUBLE; // Expected return per month in % of capital
+    double expected_return = UNSET_DOUBLE;           // Expected return per year in % of capital
+    double maximum_drawdown = UNSET_DOUBLE;          // Maximum drawdown in % of capital
+    double minimum_winrate = UNSET_DOUBLE;           // Minimum win rate in %
+    double minimum_profit_factor = UNSET_DOUBLE;     // Minimum profit factor
 };
 
 /**
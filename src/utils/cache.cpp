@@ -51,8 +51,10 @@ void Cache::create()
 
         for (auto const &[date, value] : data)
         {
-            for (auto const &[tf, candles] : value.candles)
+            for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
             {
+                TimeFrame tf = static_cast<TimeFrame>(i);
+                const std::vector<Candle> &candles = value.candles[tf];
                 for (auto const &candle : candles)
                 {
                     json_data[date]["candles"][tf_map[tf]] = nlohmann::json::array();
@@ -69,8 +71,14 @@ void Cache::create()
                 }
             }
 
-            for (auto const &[tf, indicators] : value.indicators)
+            for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
             {
+                TimeFrame tf = static_cast<TimeFrame>(i);
+                const std::unordered_map<std::string, std::vector<double>> &indicators = value.indicators[tf];
+                if (indicators.empty())
+                {
+                    continue;
+                }
                 json_data[date]["indicators"][tf_map[tf]] = nlohmann::json::object();
                 for (auto const &[id, values] : indicators)
                 {
@@ -182,9 +190,9 @@ bool Cache::exist()
  * @brief Get the value of a key in the dictionary.
  *
  * @param key The key whose value is to be retrieved.
- * @return CachedData The value of the key.
+ * @return const CachedData & The value of the key.
  */
-CachedData Cache::get(const std::string &key)
+const CachedData &Cache::get(const std::string &key)
 {
     if (!this->has(key))
     {
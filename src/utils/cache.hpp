@@ -59,9 +59,9 @@ public:
      * @brief Get the value of a key in the dictionary.
      *
      * @param key The key whose value is to be retrieved.
-     * @return The value of the key.
+     * @return The value of the key, by reference to avoid copying the cached maps.
      */
-    CachedData get(const std::string &key);
+    const CachedData &get(const std::string &key);
 
     /**
      * @brief Set the value of a key in the dictionary.
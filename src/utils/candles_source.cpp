@@ -1,4 +1,7 @@
 #include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 #include "../types.hpp"
 #include "candles_source.hpp"
 
@@ -9,93 +12,352 @@
  * @param source The source of candle data to retrieve.
  * @return std::vector<double> The candles with source.
  */
-std::vector<double> get_candles_with_source(const std::vector<Candle> &candles, std::string source)
+CandleSource parse_candle_source(const std::string &source)
+{
+    if (source == "open")
+    {
+        return CandleSource::OPEN;
+    }
+    if (source == "high")
+    {
+        return CandleSource::HIGH;
+    }
+    if (source == "low")
+    {
+        return CandleSource::LOW;
+    }
+    if (source == "close")
+    {
+        return CandleSource::CLOSE;
+    }
+    if (source == "volume")
+    {
+        return CandleSource::VOLUME;
+    }
+    if (source == "hl2")
+    {
+        return CandleSource::HL2;
+    }
+    if (source == "hlc3")
+    {
+        return CandleSource::HLC3;
+    }
+    if (source == "ohlc4")
+    {
+        return CandleSource::OHLC4;
+    }
+    if (source == "hlcc4")
+    {
+        return CandleSource::HLCC4;
+    }
+    if (source == "body-low")
+    {
+        return CandleSource::BODY_LOW;
+    }
+    if (source == "body-high")
+    {
+        return CandleSource::BODY_HIGH;
+    }
+
+    throw std::runtime_error("Unknown candle source passed to get_candles_with_source: " + source);
+}
+
+/**
+ * @brief Get the specified candle data source from the provided candles.
+ *
+ * @param candles The candles data.
+ * @param source The source of candle data to retrieve.
+ * @return std::vector<double> The candles with source.
+ */
+std::vector<double> get_candles_with_source(const std::vector<Candle> &candles, CandleSource source)
 {
     std::vector<double> values;
     values.reserve(candles.size());
 
-    if (source == "open")
+    switch (source)
     {
+    case CandleSource::OPEN:
         for (auto &candle : candles)
         {
             values.push_back(candle.open);
         }
-    }
-    else if (source == "high")
-    {
+        break;
+    case CandleSource::HIGH:
         for (auto &candle : candles)
         {
             values.push_back(candle.high);
         }
-    }
-    else if (source == "low")
-    {
+        break;
+    case CandleSource::LOW:
         for (auto &candle : candles)
         {
             values.push_back(candle.low);
         }
-    }
-    else if (source == "close")
-    {
+        break;
+    case CandleSource::CLOSE:
         for (auto &candle : candles)
         {
             values.push_back(candle.close);
         }
-    }
-    else if (source == "volume")
-    {
+        break;
+    case CandleSource::VOLUME:
         for (auto &candle : candles)
         {
             values.push_back(candle.volume);
         }
-    }
-    else if (source == "hl2")
-    {
+        break;
+    case CandleSource::HL2:
         for (auto &candle : candles)
         {
             values.push_back((candle.high + candle.low) / 2);
         }
-    }
-    else if (source == "hlc3")
-    {
+        break;
+    case CandleSource::HLC3:
         for (auto &candle : candles)
         {
             values.push_back((candle.high + candle.low + candle.close) / 3);
         }
-    }
-    else if (source == "ohlc4")
-    {
+        break;
+    case CandleSource::OHLC4:
         for (auto &candle : candles)
         {
             values.push_back((candle.open + candle.high + candle.low + candle.close) / 4);
         }
-    }
-    else if (source == "hlcc4")
-    {
+        break;
+    case CandleSource::HLCC4:
         for (auto &candle : candles)
         {
             values.push_back((candle.high + candle.low + candle.close + candle.close) / 4);
         }
-    }
-    else if (source == "body-low")
-    {
+        break;
+    case CandleSource::BODY_LOW:
         for (auto &candle : candles)
         {
             values.push_back(std::min(candle.open, candle.close));
         }
-    }
-    else if (source == "body-high")
-    {
+        break;
+    case CandleSource::BODY_HIGH:
         for (auto &candle : candles)
         {
             values.push_back(std::max(candle.open, candle.close));
         }
+        break;
     }
-    else
+
+    return values;
+}
+
+/**
+ * @brief Get the specified candle data source from the provided candles.
+ *
+ * @param candles The candles data.
+ * @param source The source of candle data to retrieve.
+ * @return std::vector<double> The candles with source.
+ */
+std::vector<double> get_candles_with_source(const std::vector<Candle> &candles, std::string source)
+{
+    return get_candles_with_source(candles, parse_candle_source(source));
+}
+
+/**
+ * @brief Get the specified candle data source from the candle columns.
+ *
+ * The plain sources are returned as a reference to the existing column
+ * without copying. The derived sources are computed into the derived buffer,
+ * 4 candles per iteration when AVX2 is available; the arithmetic matches the
+ * candle-based overload value for value.
+ *
+ * @param candles The candles data as parallel column arrays.
+ * @param source The source of candle data to retrieve.
+ * @param derived The buffer receiving a derived source.
+ * @return const AlignedVector<double> & The column holding the requested source.
+ */
+const AlignedVector<double> &get_candles_with_source(const CandleSoA &candles, CandleSource source, AlignedVector<double> &derived)
+{
+    if (source == CandleSource::OPEN)
     {
-        throw std::runtime_error("Unknown candle source passed to get_candles_with_source: " + source);
-        values = {};
+        return candles.open;
+    }
+    if (source == CandleSource::HIGH)
+    {
+        return candles.high;
+    }
+    if (source == CandleSource::LOW)
+    {
+        return candles.low;
+    }
+    if (source == CandleSource::CLOSE)
+    {
+        return candles.close;
+    }
+    if (source == CandleSource::VOLUME)
+    {
+        return candles.volume;
     }
 
-    return values;
-}
\ No newline at end of file
+    size_t count = candles.size();
+    derived.resize(count);
+
+    const double *open = candles.open.data();
+    const double *high = candles.high.data();
+    const double *low = candles.low.data();
+    const double *close = candles.close.data();
+    double *values = derived.data();
+    size_t i = 0;
+
+    if (source == CandleSource::HL2)
+    {
+#if defined(__AVX2__)
+        const __m256d half = _mm256_set1_pd(0.5);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d sum = _mm256_add_pd(_mm256_loadu_pd(&high[i]), _mm256_loadu_pd(&low[i]));
+            _mm256_storeu_pd(&values[i], _mm256_mul_pd(sum, half));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            values[i] = (high[i] + low[i]) / 2;
+        }
+    }
+    else if (source == CandleSource::HLC3)
+    {
+#if defined(__AVX2__)
+        const __m256d three = _mm256_set1_pd(3.0);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d sum = _mm256_add_pd(_mm256_add_pd(_mm256_loadu_pd(&high[i]), _mm256_loadu_pd(&low[i])), _mm256_loadu_pd(&close[i]));
+            _mm256_storeu_pd(&values[i], _mm256_div_pd(sum, three));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            values[i] = (high[i] + low[i] + close[i]) / 3;
+        }
+    }
+    else if (source == CandleSource::OHLC4)
+    {
+#if defined(__AVX2__)
+        const __m256d quarter = _mm256_set1_pd(0.25);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d sum = _mm256_add_pd(_mm256_add_pd(_mm256_loadu_pd(&open[i]), _mm256_loadu_pd(&high[i])), _mm256_add_pd(_mm256_loadu_pd(&low[i]), _mm256_loadu_pd(&close[i])));
+            _mm256_storeu_pd(&values[i], _mm256_mul_pd(sum, quarter));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            values[i] = (open[i] + high[i] + low[i] + close[i]) / 4;
+        }
+    }
+    else if (source == CandleSource::HLCC4)
+    {
+#if defined(__AVX2__)
+        const __m256d quarter = _mm256_set1_pd(0.25);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d c = _mm256_loadu_pd(&close[i]);
+            __m256d sum = _mm256_add_pd(_mm256_add_pd(_mm256_loadu_pd(&high[i]), _mm256_loadu_pd(&low[i])), _mm256_add_pd(c, c));
+            _mm256_storeu_pd(&values[i], _mm256_mul_pd(sum, quarter));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            values[i] = (high[i] + low[i] + close[i] + close[i]) / 4;
+        }
+    }
+    else if (source == CandleSource::BODY_LOW)
+    {
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4)
+        {
+            _mm256_storeu_pd(&values[i], _mm256_min_pd(_mm256_loadu_pd(&open[i]), _mm256_loadu_pd(&close[i])));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            values[i] = std::min(open[i], close[i]);
+        }
+    }
+    else if (source == CandleSource::BODY_HIGH)
+    {
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4)
+        {
+            _mm256_storeu_pd(&values[i], _mm256_max_pd(_mm256_loadu_pd(&open[i]), _mm256_loadu_pd(&close[i])));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            values[i] = std::max(open[i], close[i]);
+        }
+    }
+
+    return derived;
+}
+
+/**
+ * @brief Get the specified candle data source from the candle columns.
+ *
+ * @param candles The candles data as parallel column arrays.
+ * @param source The source of candle data to retrieve.
+ * @param derived The buffer receiving a derived source.
+ * @return const AlignedVector<double> & The column holding the requested source.
+ */
+const AlignedVector<double> &get_candles_with_source(const CandleSoA &candles, const std::string &source, AlignedVector<double> &derived)
+{
+    return get_candles_with_source(candles, parse_candle_source(source), derived);
+}
+
+/**
+ * @brief Convert the candles to a structure of arrays with one contiguous column per field.
+ *
+ * @param candles The candles data.
+ * @return CandleSoA The candles as parallel column arrays.
+ */
+CandleSoA candles_to_soa(const std::vector<Candle> &candles)
+{
+    CandleSoA source;
+    source.open.reserve(candles.size());
+    source.high.reserve(candles.size());
+    source.low.reserve(candles.size());
+    source.close.reserve(candles.size());
+    source.volume.reserve(candles.size());
+
+    for (auto &candle : candles)
+    {
+        source.open.push_back(candle.open);
+        source.high.push_back(candle.high);
+        source.low.push_back(candle.low);
+        source.close.push_back(candle.close);
+        source.volume.push_back(candle.volume);
+    }
+
+    return source;
+}
+/**
+ * @brief Convert the candles to a structure of float32 arrays with one contiguous column per field.
+ *
+ * @param candles The candles data.
+ * @return CandleSoAf The candles as parallel float32 column arrays.
+ */
+CandleSoAf candles_to_soa_f(const std::vector<Candle> &candles)
+{
+    CandleSoAf source;
+    source.open.reserve(candles.size());
+    source.high.reserve(candles.size());
+    source.low.reserve(candles.size());
+    source.close.reserve(candles.size());
+    source.volume.reserve(candles.size());
+
+    for (auto &candle : candles)
+    {
+        source.open.push_back(static_cast<float>(candle.open));
+        source.high.push_back(static_cast<float>(candle.high));
+        source.low.push_back(static_cast<float>(candle.low));
+        source.close.push_back(static_cast<float>(candle.close));
+        source.volume.push_back(static_cast<float>(candle.volume));
+    }
+
+    return source;
+}
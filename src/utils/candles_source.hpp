@@ -1,18 +1,107 @@
 #ifndef CANDLES_SOURCE_H
 #define CANDLES_SOURCE_H
 
+#include <string>
 #include <vector>
+#include <cstdint>
 #include <stdexcept>
 #include "../types.hpp"
 
+/**
+ * @brief Enum for the candle data sources.
+ */
+enum class CandleSource : uint8_t
+{
+    OPEN,
+    HIGH,
+    LOW,
+    CLOSE,
+    VOLUME,
+    HL2,
+    HLC3,
+    OHLC4,
+    HLCC4,
+    BODY_LOW,
+    BODY_HIGH
+};
+
+/**
+ * @brief Parse a candle source name into its enum value.
+ *
+ * Meant to run once when an indicator is constructed, so the per-candle
+ * extraction dispatches on a small enum instead of comparing strings.
+ *
+ * @param source The source name.
+ * @return CandleSource The parsed source.
+ * @throws std::runtime_error If an unknown candle source is passed.
+ */
+CandleSource parse_candle_source(const std::string &source);
+
 /**
  * @brief Get the specified candle data source from the provided candles.
  *
  * @param candles The candles data.
  * @param source The source of candle data to retrieve.
  * @return std::vector<double> The candles with source.
+ */
+std::vector<double> get_candles_with_source(const std::vector<Candle> &candles, CandleSource source);
+
+/**
+ * @brief Get the specified candle data source from the provided candles.
+ *
+ * Convenience overload that parses the source name on every call; the hot
+ * paths parse once with parse_candle_source and use the enum overload.
+ *
+ * @param candles The candles data.
+ * @param source The source of candle data to retrieve.
+ * @return std::vector<double> The candles with source.
  * @throws std::runtime_error If an unknown candle source is passed.
  */
 std::vector<double> get_candles_with_source(const std::vector<Candle> &candles, std::string source);
 
+/**
+ * @brief Get the specified candle data source from the candle columns.
+ *
+ * The plain sources ("open", "high", "low", "close", "volume") are returned as
+ * a reference to the existing column without copying. The derived sources
+ * ("hl2", "hlc3", "ohlc4", "hlcc4", "body-low", "body-high") are computed into
+ * the derived buffer, 4 candles per iteration when AVX2 is available, and a
+ * reference to that buffer is returned.
+ *
+ * @param candles The candles data as parallel column arrays.
+ * @param source The source of candle data to retrieve.
+ * @param derived The buffer receiving a derived source.
+ * @return const AlignedVector<double> & The column holding the requested source.
+ * @throws std::runtime_error If an unknown candle source is passed.
+ */
+const AlignedVector<double> &get_candles_with_source(const CandleSoA &candles, const std::string &source, AlignedVector<double> &derived);
+
+/**
+ * @brief Get the specified candle data source from the candle columns.
+ *
+ * Enum-dispatched variant of the column overload for the hot paths.
+ *
+ * @param candles The candles data as parallel column arrays.
+ * @param source The source of candle data to retrieve.
+ * @param derived The buffer receiving a derived source.
+ * @return const AlignedVector<double> & The column holding the requested source.
+ */
+const AlignedVector<double> &get_candles_with_source(const CandleSoA &candles, CandleSource source, AlignedVector<double> &derived);
+
+/**
+ * @brief Convert the candles to a structure of arrays with one contiguous column per field.
+ *
+ * @param candles The candles data.
+ * @return CandleSoA The candles as parallel column arrays.
+ */
+CandleSoA candles_to_soa(const std::vector<Candle> &candles);
+
+/**
+ * @brief Convert the candles to a structure of float32 arrays with one contiguous column per field.
+ *
+ * @param candles The candles data.
+ * @return CandleSoAf The candles as parallel float32 column arrays.
+ */
+CandleSoAf candles_to_soa_f(const std::vector<Candle> &candles);
+
 #endif /* CANDLES_SOURCE_H */
\ No newline at end of file
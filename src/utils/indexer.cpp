@@ -14,10 +14,14 @@
  */
 Indexer::Indexer(const CandlesData &candles, int window) : candles(candles), window(window)
 {
-    // Initialize indexes with start and end set to 0 for each timeframe
-    for (const auto &[tf, c] : candles)
+    // Initialize indexes with start and end set to 0 for each timeframe with data
+    for (size_t i = 0; i < NB_TIMEFRAMES; ++i)
     {
-        this->indexes[tf] = std::make_pair(0, 0);
+        TimeFrame tf = static_cast<TimeFrame>(i);
+        if (!candles[tf].empty())
+        {
+            this->indexes[tf] = std::make_pair(0, 0);
+        }
     }
 }
 
@@ -28,8 +32,10 @@ Indexer::Indexer(const CandlesData &candles, int window) : candles(candles), win
  */
 void Indexer::update_indexes(time_t date)
 {
-    for (auto &[tf, c] : this->candles)
+    for (auto &[tf, index] : this->indexes)
     {
+        const std::vector<Candle> &c = this->candles[tf];
+
         // Update the indexes
         while (this->indexes[tf].second < c.size() && c[this->indexes[tf].second].date <= date)
         {
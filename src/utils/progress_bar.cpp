@@ -1,8 +1,62 @@
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <chrono>
 #include "progress_bar.hpp"
 
+namespace
+{
+    // Two-digit lookup table: value v in [0, 99] is spelled by the pair at
+    // digit_pairs[2 * v], so writing an integer costs one table load per two
+    // digits instead of a division per digit.
+    constexpr char digit_pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    /**
+     * @brief Write an unsigned integer into a buffer without allocating.
+     * @param out The output buffer.
+     * @param value The value to write.
+     * @return size_t The number of characters written.
+     */
+    size_t write_uint(char *out, uint64_t value)
+    {
+        char tmp[20];
+        char *p = tmp + sizeof(tmp);
+        while (value >= 100)
+        {
+            uint64_t pair = (value % 100) * 2;
+            *--p = digit_pairs[pair + 1];
+            *--p = digit_pairs[pair];
+            value /= 100;
+        }
+        if (value >= 10)
+        {
+            *--p = digit_pairs[value * 2 + 1];
+            *--p = digit_pairs[value * 2];
+        }
+        else
+        {
+            *--p = static_cast<char>('0' + value);
+        }
+        size_t len = tmp + sizeof(tmp) - p;
+        for (size_t i = 0; i < len; ++i)
+        {
+            out[i] = p[i];
+        }
+        return len;
+    }
+}
+
 /**
  * @brief Constructs a progress bar.
  * @param width The width of the progress bar.
@@ -10,7 +64,14 @@
  * @param label The label for the progress bar.
  */
 ProgressBar::ProgressBar(int width, int total_iterations, std::string label)
-    : width(width), current_iteration(0), total_iterations(total_iterations), label(label) {}
+    : width(width), current_iteration(0), total_iterations(total_iterations), label(label)
+{
+    // The clock is read here instead of in a default member initializer, so
+    // it is sampled exactly once per bar
+    this->start_time = std::chrono::steady_clock::now();
+    this->last_paint_time = this->start_time - paint_interval;
+    this->render_buffer.reserve(width + 80);
+}
 
 /**
  * @brief Updates the progress bar with the iteration given.
@@ -20,30 +81,49 @@ ProgressBar::ProgressBar(int width, int total_iterations, std::string label)
 void ProgressBar::update(int progress_iteration, std::string new_label)
 {
     current_iteration += progress_iteration;
+
+    // Skip the repaint unless enough time has passed or the bar is complete
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (now - last_paint_time < paint_interval && current_iteration < total_iterations)
+    {
+        return;
+    }
+    last_paint_time = now;
+
     float progress = static_cast<float>(current_iteration) / total_iterations;
     int pos = static_cast<int>(width * progress);
-    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
     std::chrono::duration<double> elapsed_time = now - start_time;
     double estimated_time_remaining = (elapsed_time.count() / progress) * (1 - progress);
 
-    std::cout << "\r";
-    std::cout << label << " [";
-    for (int i = 0; i < width; ++i)
+    // Render the bar into the reused buffer and write it out in one piece
+    char time_buffer[32];
+    render_buffer.clear();
+    render_buffer += '\r';
+    render_buffer += label;
+    render_buffer += " [";
+    int filled = pos < width ? pos : width;
+    render_buffer.append(filled, '=');
+    if (pos < width)
     {
-        if (i < pos)
-            std::cout << "=";
-        else if (i == pos)
-            std::cout << ">";
-        else
-            std::cout << " ";
+        render_buffer += '>';
+        render_buffer.append(width - pos - 1, ' ');
     }
-    std::cout << "] " << int(progress * 100.0) << "% (" << current_iteration << "/" << total_iterations << ")"
-              << " Elapsed: " << format_time(elapsed_time.count())
-              << " Remaining: " << format_time(estimated_time_remaining);
+    render_buffer += "] ";
+    render_buffer += std::to_string(int(progress * 100.0));
+    render_buffer += "% (";
+    render_buffer += std::to_string(current_iteration);
+    render_buffer += '/';
+    render_buffer += std::to_string(total_iterations);
+    render_buffer += ") Elapsed: ";
+    render_buffer.append(time_buffer, format_time(time_buffer, elapsed_time.count()));
+    render_buffer += " Remaining: ";
+    render_buffer.append(time_buffer, format_time(time_buffer, estimated_time_remaining));
     if (!new_label.empty())
     {
-        std::cout << " - " << new_label;
+        render_buffer += " - ";
+        render_buffer += new_label;
     }
+    std::cout << render_buffer;
     std::cout.flush();
 }
 
@@ -71,16 +151,39 @@ void ProgressBar::complete(std::string message)
  */
 std::string ProgressBar::format_time(double seconds)
 {
-    int hours = static_cast<int>(seconds / 3600);
-    seconds -= hours * 3600;
-    int minutes = static_cast<int>(seconds / 60);
-    seconds -= minutes * 60;
+    char buffer[32];
+    size_t length = format_time(buffer, seconds);
+    return std::string(buffer, length);
+}
 
-    std::string formatted_time;
+/**
+ * @brief Formats a time duration into a stack buffer without allocating.
+ * @param out The output buffer (at least 32 bytes).
+ * @param seconds The time duration in seconds.
+ * @return The number of characters written.
+ */
+size_t ProgressBar::format_time(char *out, double seconds)
+{
+    uint64_t total = (std::isfinite(seconds) && seconds > 0) ? static_cast<uint64_t>(seconds) : 0;
+    uint64_t hours = total / 3600;
+    uint64_t minutes = (total % 3600) / 60;
+    uint64_t secs = total % 60;
+
+    char *p = out;
     if (hours > 0)
-        formatted_time += std::to_string(hours) + "h ";
+    {
+        p += write_uint(p, hours);
+        *p++ = 'h';
+        *p++ = ' ';
+    }
     if (minutes > 0)
-        formatted_time += std::to_string(minutes) + "m ";
-    formatted_time += std::to_string(static_cast<int>(seconds)) + "s";
-    return formatted_time;
+    {
+        p += write_uint(p, minutes);
+        *p++ = 'm';
+        *p++ = ' ';
+    }
+    p += write_uint(p, secs);
+    *p++ = 's';
+    *p = '\0';
+    return p - out;
 }
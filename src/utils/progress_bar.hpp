@@ -2,6 +2,7 @@
 #define PROGRESS_BAR_HPP
 
 #include <chrono>
+#include <cstddef>
 #include <iostream>
 #include <string>
 
@@ -36,8 +37,15 @@ private:
     int width;                                                                           // The width of the progress bar.
     int current_iteration;                                                               // The current iteration count.
     int total_iterations;                                                                // The total number of iterations.
-    std::string label;                                                                   // The label for the progress bar.
-    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now(); // The start time of the progress bar.
+    std::string label;                               // The label for the progress bar.
+    std::chrono::steady_clock::time_point start_time; // The start time of the progress bar, set once in the constructor.
+    std::string render_buffer;                       // Reused buffer the bar is rendered into, written to std::cout in one piece.
+
+    // Repaint at most every 100 ms: the bar is updated once per iteration, and
+    // writing and flushing std::cout on every call costs more than the work it
+    // reports on. Seeded one interval in the past so the first update paints.
+    static constexpr std::chrono::milliseconds paint_interval{100};
+    std::chrono::steady_clock::time_point last_paint_time; // The time of the last repaint.
 
     /**
      * @brief Formats a time duration in seconds to a human-readable format.
@@ -45,6 +53,14 @@ private:
      * @return The formatted time string.
      */
     std::string format_time(double seconds);
+
+    /**
+     * @brief Formats a time duration into a stack buffer without allocating.
+     * @param out The output buffer (at least 32 bytes).
+     * @param seconds The time duration in seconds.
+     * @return The number of characters written.
+     */
+    static size_t format_time(char *out, double seconds);
 };
 
 #endif // PROGRESS_BAR_HPP
@@ -0,0 +1,74 @@
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "string_arena.hpp"
+
+/**
+ * @brief Intern a string and get its ID.
+ *
+ * The same string always gets the same ID.
+ *
+ * @param str The string to intern.
+ * @return uint16_t The ID of the interned string.
+ */
+uint16_t StringArena::intern(std::string_view str)
+{
+    auto it = this->idx.find(str);
+    if (it != this->idx.end())
+    {
+        return it->second;
+    }
+
+    uint16_t id = static_cast<uint16_t>(this->storage.size());
+    this->storage.emplace_back(str);
+    this->idx[std::string_view(this->storage.back())] = id;
+    return id;
+}
+
+/**
+ * @brief Get the string behind an ID.
+ *
+ * @param id The ID of an interned string.
+ * @return const std::string & The interned string.
+ * @throws std::runtime_error If the ID does not belong to an interned string.
+ */
+const std::string &StringArena::view(uint16_t id) const
+{
+    if (id >= this->storage.size())
+    {
+        throw std::runtime_error("Error: Unknown interned string ID");
+    }
+    return this->storage[id];
+}
+
+namespace
+{
+    StringArena &global_arena()
+    {
+        static StringArena arena;
+        return arena;
+    }
+}
+
+/**
+ * @brief Intern a string into the global arena and get its ID.
+ *
+ * @param str The string to intern.
+ * @return uint16_t The ID of the interned string.
+ */
+uint16_t intern_string(std::string_view str)
+{
+    return global_arena().intern(str);
+}
+
+/**
+ * @brief Get the string behind an ID of the global arena.
+ *
+ * @param id The ID of an interned string.
+ * @return const std::string & The interned string.
+ * @throws std::runtime_error If the ID does not belong to an interned string.
+ */
+const std::string &interned_string(uint16_t id)
+{
+    return global_arena().view(id);
+}
@@ -0,0 +1,62 @@
+#ifndef STRING_ARENA_H
+#define STRING_ARENA_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief Arena interning strings into small integer IDs.
+ *
+ * Structs copied in the hot loop (e.g. SymbolInfo) store a 2-byte ID instead
+ * of a std::string, so copying them allocates nothing and comparing two
+ * values is a single integer compare. The original string stays available
+ * for the I/O paths through view().
+ */
+class StringArena
+{
+public:
+    /**
+     * @brief Intern a string and get its ID.
+     *
+     * The same string always gets the same ID.
+     *
+     * @param str The string to intern.
+     * @return uint16_t The ID of the interned string.
+     */
+    uint16_t intern(std::string_view str);
+
+    /**
+     * @brief Get the string behind an ID.
+     *
+     * @param id The ID of an interned string.
+     * @return const std::string & The interned string.
+     * @throws std::runtime_error If the ID does not belong to an interned string.
+     */
+    const std::string &view(uint16_t id) const;
+
+private:
+    std::deque<std::string> storage;                // Interned strings, indexed by ID (deque so views stay stable)
+    std::unordered_map<std::string_view, uint16_t> idx; // Lookup from string to ID (views point into storage)
+};
+
+/**
+ * @brief Intern a string into the global arena and get its ID.
+ *
+ * @param str The string to intern.
+ * @return uint16_t The ID of the interned string.
+ */
+uint16_t intern_string(std::string_view str);
+
+/**
+ * @brief Get the string behind an ID of the global arena.
+ *
+ * @param id The ID of an interned string.
+ * @return const std::string & The interned string.
+ * @throws std::runtime_error If the ID does not belong to an interned string.
+ */
+const std::string &interned_string(uint16_t id);
+
+#endif // STRING_ARENA_H
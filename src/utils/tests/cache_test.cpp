@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <filesystem>
 #include "../cache.hpp"
 
 // Fixture class for Cache tests
@@ -1,24 +1,33 @@
 #include <gtest/gtest.h>
 #include <ctime>
+#include <array>
 #include <vector>
 #include <stdexcept>
 #include <chrono>
 #include "../candles_source.hpp"
 #include "../../types.hpp"
 
-class TestCandlesSource : public ::testing::Test
+// One table entry per candle source: the source and the expected values for
+// the two mock candles
+struct CandleSourceCase
+{
+    CandleSource source;
+    std::array<double, 2> expected;
+};
+
+class TestCandlesSource : public ::testing::TestWithParam<CandleSourceCase>
 {
 protected:
     void SetUp() override
     {
         // Define a tm struct with the desired date and time
         std::tm timeInfo = {
-            .tm_year = 2023 - 1900,
-            .tm_mon = 1,
-            .tm_mday = 1,
-            .tm_hour = 0,
-            .tm_min = 0,
             .tm_sec = 0,
+            .tm_min = 0,
+            .tm_hour = 0,
+            .tm_mday = 1,
+            .tm_mon = 1,
+            .tm_year = 2023 - 1900,
         };
 
         // Convert tm struct to time_t
@@ -37,71 +46,55 @@ TEST_F(TestCandlesSource, GetCandlesWithUnknownSource)
     EXPECT_THROW(get_candles_with_source(mock_candles, "unknown"), std::runtime_error);
 }
 
-TEST_F(TestCandlesSource, GetCandlesWithSource)
+TEST_P(TestCandlesSource, GetCandlesWithSource)
 {
-    // Open
-    std::vector<double> candles = get_candles_with_source(mock_candles, "open");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 2);
-    EXPECT_EQ(candles[1], 2);
+    const CandleSourceCase &test_case = GetParam();
 
-    // High
-    candles = get_candles_with_source(mock_candles, "high");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 3);
-    EXPECT_EQ(candles[1], 3);
-
-    // Low
-    candles = get_candles_with_source(mock_candles, "low");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 1);
-    EXPECT_EQ(candles[1], 1);
-
-    // Close
-    candles = get_candles_with_source(mock_candles, "close");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 2);
-    EXPECT_EQ(candles[1], 2);
-
-    // Volume
-    candles = get_candles_with_source(mock_candles, "volume");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 100);
-    EXPECT_EQ(candles[1], 110);
-
-    // HL2
-    candles = get_candles_with_source(mock_candles, "hl2");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 2);
-    EXPECT_EQ(candles[1], 2);
-
-    // HLC3
-    candles = get_candles_with_source(mock_candles, "hlc3");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 2);
-    EXPECT_EQ(candles[1], 2);
-
-    // OHLC4
-    candles = get_candles_with_source(mock_candles, "ohlc4");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 2);
-    EXPECT_EQ(candles[1], 2);
-
-    // HLCC4
-    candles = get_candles_with_source(mock_candles, "hlcc4");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 2);
-    EXPECT_EQ(candles[1], 2);
+    std::vector<double> candles = get_candles_with_source(mock_candles, test_case.source);
+    ASSERT_EQ(candles.size(), test_case.expected.size());
+    for (size_t i = 0; i < candles.size(); ++i)
+    {
+        EXPECT_EQ(candles[i], test_case.expected[i]);
+    }
+}
 
-    // Body Low
-    candles = get_candles_with_source(mock_candles, "body-low");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 2);
-    EXPECT_EQ(candles[1], 2);
+// One instantiation per candle source, sharing the single test body above
+INSTANTIATE_TEST_SUITE_P(
+    AllSources, TestCandlesSource,
+    ::testing::Values(
+        CandleSourceCase{CandleSource::OPEN, {2, 2}},
+        CandleSourceCase{CandleSource::HIGH, {3, 3}},
+        CandleSourceCase{CandleSource::LOW, {1, 1}},
+        CandleSourceCase{CandleSource::CLOSE, {2, 2}},
+        CandleSourceCase{CandleSource::VOLUME, {100, 110}},
+        CandleSourceCase{CandleSource::HL2, {2, 2}},
+        CandleSourceCase{CandleSource::HLC3, {2, 2}},
+        CandleSourceCase{CandleSource::OHLC4, {2, 2}},
+        CandleSourceCase{CandleSource::HLCC4, {2, 2}},
+        CandleSourceCase{CandleSource::BODY_LOW, {2, 2}},
+        CandleSourceCase{CandleSource::BODY_HIGH, {2, 2}}));
+
+TEST_F(TestCandlesSource, GetCandlesWithSourceFromColumns)
+{
+    CandleSoA columns = candles_to_soa(mock_candles);
+    AlignedVector<double> derived;
+
+    // The plain sources are views on the existing columns
+    ASSERT_EQ(&get_candles_with_source(columns, "open", derived), &columns.open);
+    ASSERT_EQ(&get_candles_with_source(columns, "high", derived), &columns.high);
+    ASSERT_EQ(&get_candles_with_source(columns, "low", derived), &columns.low);
+    ASSERT_EQ(&get_candles_with_source(columns, "close", derived), &columns.close);
+    ASSERT_EQ(&get_candles_with_source(columns, "volume", derived), &columns.volume);
+
+    // Every source matches the candle-based overload
+    std::vector<std::string> sources = {"open", "high", "low", "close", "volume", "hl2", "hlc3", "ohlc4", "hlcc4", "body-low", "body-high"};
+    for (const auto &source : sources)
+    {
+        std::vector<double> expected = get_candles_with_source(mock_candles, source);
+        const AlignedVector<double> &actual = get_candles_with_source(columns, source, derived);
+        ASSERT_EQ(std::vector<double>(actual.begin(), actual.end()), expected);
+    }
 
-    // Body High
-    candles = get_candles_with_source(mock_candles, "body-high");
-    ASSERT_EQ(candles.size(), 2);
-    EXPECT_EQ(candles[0], 2);
-    EXPECT_EQ(candles[1], 2);
+    // An unknown source still throws
+    EXPECT_THROW(get_candles_with_source(columns, "unknown", derived), std::runtime_error);
 }
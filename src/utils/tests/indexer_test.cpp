@@ -15,12 +15,12 @@ protected:
     {
         // 2023-01-01 01:00:00
         std::tm date = {
-            .tm_year = 2023 - 1900,
-            .tm_mon = 1,
-            .tm_mday = 1,
-            .tm_hour = 1,
+            .tm_sec = 0,
             .tm_min = 0,
-            .tm_sec = 0};
+            .tm_hour = 1,
+            .tm_mday = 1,
+            .tm_mon = 1,
+            .tm_year = 2023 - 1900};
 
         initial_date = std::mktime(&date);
         window = 2;
@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "../string_arena.hpp"
+
+TEST(StringArenaTest, InternAndView)
+{
+    StringArena arena;
+
+    // Interning the same string twice yields the same ID
+    uint16_t eur = arena.intern("EUR");
+    uint16_t usd = arena.intern("USD");
+    ASSERT_NE(eur, usd);
+    ASSERT_EQ(arena.intern("EUR"), eur);
+    ASSERT_EQ(arena.intern("USD"), usd);
+
+    // The ID maps back to the original string
+    ASSERT_EQ(arena.view(eur), "EUR");
+    ASSERT_EQ(arena.view(usd), "USD");
+
+    // An unknown ID throws
+    ASSERT_THROW(arena.view(1000), std::runtime_error);
+}
+
+TEST(StringArenaTest, GlobalArena)
+{
+    uint16_t id = intern_string("GBP");
+    ASSERT_EQ(intern_string("GBP"), id);
+    ASSERT_EQ(interned_string(id), "GBP");
+}
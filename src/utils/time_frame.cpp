@@ -3,37 +3,7 @@
 #include <string>
 #include <vector>
 #include "../types.hpp"
-
-/**
- * @brief Get the number of minutes for the specified timeframe.
- *
- * @param time_frame The timeframe for which the number of minutes is requested.
- * @return int The number of minutes corresponding to the specified timeframe.
- */
-int get_time_frame_in_minutes(TimeFrame time_frame)
-{
-    switch (time_frame)
-    {
-    case TimeFrame::M1:
-        return 1;
-    case TimeFrame::M5:
-        return 5;
-    case TimeFrame::M15:
-        return 15;
-    case TimeFrame::M30:
-        return 30;
-    case TimeFrame::H1:
-        return 60;
-    case TimeFrame::H4:
-        return 60 * 4;
-    case TimeFrame::H12:
-        return 60 * 12;
-    case TimeFrame::D1:
-        return 60 * 24;
-    default:
-        throw std::runtime_error("The time frame is invalid.");
-    }
-}
+#include "time_frame.hpp"
 
 /**
  * @brief Check if the given time matches the specified format for the given timeframe.
@@ -10,10 +10,20 @@
 /**
  * @brief Get the number of minutes for the specified timeframe.
  *
+ * Defined inline so hot call sites compile down to a single table load.
+ *
  * @param time_frame The timeframe for which the number of minutes is requested.
  * @return int The number of minutes corresponding to the specified timeframe.
+ * @throws std::runtime_error If the timeframe is invalid.
  */
-int get_time_frame_in_minutes(TimeFrame time_frame);
+inline int get_time_frame_in_minutes(TimeFrame time_frame)
+{
+    if (static_cast<size_t>(time_frame) >= NB_TIMEFRAMES)
+    {
+        throw std::runtime_error("The time frame is invalid.");
+    }
+    return TIME_FRAME_MINUTES[static_cast<size_t>(time_frame)];
+}
 
 /**
  * @brief Check if the given time matches the specified format for the given timeframe.